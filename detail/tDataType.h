@@ -47,6 +47,7 @@
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "rrlib/rtti/rtti.h"
+#include "rrlib/rtti/registration_profiling.h"
 #include "rrlib/rtti/type_traits.h"
 #include "rrlib/rtti/tType.h"
 
@@ -125,7 +126,13 @@ public:
    */
   inline static tInfo* GetDataTypeInfo(const char* name = nullptr)
   {
+#if RRLIB_RTTI_REGISTRATION_PROFILING_ENABLED
+    static detail::tRegistrationProfiler::tInfoConstructionBegin profiling_begin;
+#endif
     static tDataTypeInfo<T, std::is_enum<T>::value> info(name);
+#if RRLIB_RTTI_REGISTRATION_PROFILING_ENABLED
+    static detail::tRegistrationProfiler::tInfoConstructionEnd profiling_end(&info);
+#endif
     if (name && info.name != name) // hopefully, compiler optimizes this away for all calls with name == nullptr
     {
       RRLIB_LOG_PRINT_STATIC(ERROR, "Type name '", info.name, "' can only be changed on initial instantiation of tDataType<T>.");
@@ -150,16 +157,21 @@ private:
 
     virtual tGenericObject* CreateInstanceGeneric(void* placement, bool emplace_generic_object) const override;
 
-    virtual void DeepCopy(const void* src, void* dest, tFactory* f) const override;
-
-    virtual void Deserialize(serialization::tInputStream& is, void* obj) const override;
-
-    virtual void Serialize(serialization::tOutputStream& os, const void* obj) const override;
+    virtual tGenericObject* EmplaceInstanceGeneric(void* data_placement, void* wrapper_placement) const override;
 
     virtual void Init() override
     {
       AutoRegisterRelatedTypes<T>::Register();
     }
+
+    // Generic operations (see tType::tOperations)
+    static void Construct(void* placement, size_t count);
+    static void Destruct(void* data, size_t count);
+    static void DeepCopy(const void* source, void* destination, tFactory* factory);
+    static void MoveConstruct(void* source, void* destination);
+    static bool Equals(const void* object1, const void* object2);
+    static void Serialize(serialization::tOutputStream& stream, const void* object);
+    static void Deserialize(serialization::tInputStream& stream, void* object);
   };
 
   template <typename U, bool Enum>
@@ -69,12 +69,65 @@ namespace detail
 // Implementation
 //----------------------------------------------------------------------
 
+/*!
+ * Constructs object of type T at specified address (using default constructor if available)
+ */
+template <typename T, bool NO_ARG_CONSTRUCTOR = std::is_base_of<serialization::DefaultImplementation, serialization::DefaultInstantiation<T>>::value>
+struct tInstanceConstructor
+{
+  static void Construct(void* address)
+  {
+    new(address) T(serialization::DefaultInstantiation<T>::Create());
+  }
+};
+
+template <typename T>
+struct tInstanceConstructor<T, true>
+{
+  static void Construct(void* address)
+  {
+    new(address) T();
+  }
+};
+
+/*!
+ * Constructs object of type T at destination - moving contents from source (or deep-copying them if T cannot be moved)
+ */
+template <typename T, bool MOVE_CONSTRUCTIBLE = std::is_move_constructible<T>::value>
+struct tInstanceMover
+{
+  static void MoveConstruct(T& source, void* destination)
+  {
+    new(destination) T(std::move(source));
+  }
+};
+
+template <typename T>
+struct tInstanceMover<T, false>
+{
+  static void MoveConstruct(T& source, void* destination)
+  {
+    tInstanceConstructor<T>::Construct(destination);
+    GenericOperations<T>::DeepCopy(source, *static_cast<T*>(destination));
+  }
+};
+
 template<typename T>
 tDataType<T>::tDataTypeInfoBase::tDataTypeInfoBase(tType::tClassification classification, const std::string& name) :
   tInfo(classification, typeid(T).name(), name)
 {
   size = sizeof(T);
   generic_object_size = sizeof(tGenericObjectInstance<T>);
+  alignment = alignof(T);
+  generic_object_alignment = alignof(tGenericObjectInstance<T>);
+  emplaced_generic_object_size = sizeof(detail::tGenericObjectInstanceEmplaced<T>);
+  operations.construct = &Construct;
+  operations.destruct = &Destruct;
+  operations.deep_copy = &DeepCopy;
+  operations.move_construct = &MoveConstruct;
+  operations.equals = &Equals;
+  operations.serialize = &Serialize;
+  operations.deserialize = &Deserialize;
   type_traits = tTypeTraitsVector<T>::value;
   binary = GetBinaryCurrentlyPerformingStaticInitialization();
 #if RRLIB_RTTI_BINARY_DETECTION_ENABLED
@@ -89,6 +142,29 @@ tDataType<T>::tDataTypeInfoBase::tDataTypeInfoBase(tType::tClassification classi
 #endif
 }
 
+template<typename T>
+void tDataType<T>::tDataTypeInfoBase::Construct(void* placement, size_t count)
+{
+  if (RequiresZeroFill<T>::value)
+  {
+    memset(placement, 0, count * sizeof(T)); // see CreateInstanceGeneric
+  }
+  T* instances = static_cast<T*>(placement);
+  size_t constructed = 0;
+  try
+  {
+    for (; constructed < count; constructed++)
+    {
+      tInstanceConstructor<T>::Construct(&instances[constructed]);
+    }
+  }
+  catch (...)
+  {
+    Destruct(placement, constructed);
+    throw;
+  }
+}
+
 template<typename T>
 tGenericObject* tDataType<T>::tDataTypeInfoBase::CreateInstanceGeneric(void* placement, bool emplace_generic_object) const
 {
@@ -96,7 +172,10 @@ tGenericObject* tDataType<T>::tDataTypeInfoBase::CreateInstanceGeneric(void* pla
   {
     placement = operator new(emplace_generic_object ? sizeof(tGenericObjectInstance<T>) : sizeof(T));
   }
-  memset(placement, 0, emplace_generic_object ? sizeof(tGenericObjectInstance<T>) : sizeof(T)); // set memory to 0 so that memcmp on class T can be performed cleanly for certain types
+  if (RequiresZeroFill<T>::value)
+  {
+    memset(placement, 0, emplace_generic_object ? sizeof(tGenericObjectInstance<T>) : sizeof(T)); // set memory to 0 so that memcmp on class T can be performed cleanly
+  }
   if (emplace_generic_object)
   {
     return new(placement) tGenericObjectInstance<T>();
@@ -108,10 +187,20 @@ tGenericObject* tDataType<T>::tDataTypeInfoBase::CreateInstanceGeneric(void* pla
 }
 
 template<typename T>
-void tDataType<T>::tDataTypeInfoBase::DeepCopy(const void* src, void* dest, tFactory* f) const
+tGenericObject* tDataType<T>::tDataTypeInfoBase::EmplaceInstanceGeneric(void* data_placement, void* wrapper_placement) const
 {
-  const T* s = static_cast<const T*>(src);
-  T* d = static_cast<T*>(dest);
+  if (RequiresZeroFill<T>::value)
+  {
+    memset(data_placement, 0, sizeof(T)); // see CreateInstanceGeneric
+  }
+  return new(wrapper_placement) detail::tGenericObjectInstanceEmplaced<T>(data_placement, true);
+}
+
+template<typename T>
+void tDataType<T>::tDataTypeInfoBase::DeepCopy(const void* source, void* destination, tFactory*)
+{
+  const T* s = static_cast<const T*>(source);
+  T* d = static_cast<T*>(destination);
 
   if (std::has_virtual_destructor<T>::value)
   {
@@ -123,25 +212,47 @@ void tDataType<T>::tDataTypeInfoBase::DeepCopy(const void* src, void* dest, tFac
 }
 
 template<typename T>
-void tDataType<T>::tDataTypeInfoBase::Deserialize(serialization::tInputStream& is, void* obj) const
+void tDataType<T>::tDataTypeInfoBase::Destruct(void* data, size_t count)
 {
-  T* s = static_cast<T*>(obj);
+  T* instances = static_cast<T*>(data);
+  for (size_t i = 0; i < count; i++)
+  {
+    instances[i].~T();
+  }
+}
+
+template<typename T>
+void tDataType<T>::tDataTypeInfoBase::Deserialize(serialization::tInputStream& stream, void* object)
+{
+  T* s = static_cast<T*>(object);
   if (std::has_virtual_destructor<T>::value)
   {
     assert(typeid(*s).name() == typeid(T).name());
   }
-  serialization::Deserialize(is, *s);
+  serialization::Deserialize(stream, *s);
+}
+
+template<typename T>
+bool tDataType<T>::tDataTypeInfoBase::Equals(const void* object1, const void* object2)
+{
+  return GenericOperations<T>::Equals(*static_cast<const T*>(object1), *static_cast<const T*>(object2));
+}
+
+template<typename T>
+void tDataType<T>::tDataTypeInfoBase::MoveConstruct(void* source, void* destination)
+{
+  tInstanceMover<T>::MoveConstruct(*static_cast<T*>(source), destination);
 }
 
 template<typename T>
-void tDataType<T>::tDataTypeInfoBase::Serialize(serialization::tOutputStream& os, const void* obj) const
+void tDataType<T>::tDataTypeInfoBase::Serialize(serialization::tOutputStream& stream, const void* object)
 {
-  const T* s = static_cast<const T*>(obj);
+  const T* s = static_cast<const T*>(object);
   if (std::has_virtual_destructor<T>::value)
   {
     assert(typeid(*s).name() == typeid(T).name());
   }
-  serialization::Serialize(os, *s);
+  serialization::Serialize(stream, *s);
 }
 
 //----------------------------------------------------------------------
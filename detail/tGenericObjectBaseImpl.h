@@ -29,8 +29,9 @@
  *
  * \b tGenericObjectBaseImpl
  *
- * This class implements all type-specific generic operations of
- * tGenericObject.
+ * This class implements the type-specific generic operations of
+ * tGenericObject that are not contained in the type's operation table
+ * (see tType::tOperations) - e.g. string and XML serialization.
  */
 //----------------------------------------------------------------------
 #ifndef __rrlib__rtti__detail__tGenericObjectBaseImpl_h__
@@ -67,8 +68,9 @@ namespace detail
 //----------------------------------------------------------------------
 //! Generic object implementation
 /*!
- * This class implements all type-specific generic operations of
- * tGenericObject.
+ * This class implements the type-specific generic operations of
+ * tGenericObject that are not contained in the type's operation table
+ * (see tType::tOperations) - e.g. string and XML serialization.
  */
 template<typename T>
 class tGenericObjectBaseImpl : public tGenericObject
@@ -80,26 +82,14 @@ class tGenericObjectBaseImpl : public tGenericObject
 //----------------------------------------------------------------------
 public:
 
+  using tGenericObject::Deserialize;
+  using tGenericObject::Serialize;
+
   virtual void Clear() override
   {
     //TODO
   }
 
-  /*!
-   * Deep copy source object to this object
-   *
-   * \param source Source object
-   */
-  inline void DeepCopyFromImpl(const T& source, tFactory* f = NULL)
-  {
-    GenericOperations<T>::DeepCopy(source, this->GetData<T>());
-  }
-
-  virtual void Deserialize(serialization::tInputStream& is) override
-  {
-    serialization::Deserialize(is, tGenericObject::GetData<T>());
-  }
-
   virtual void Deserialize(serialization::tStringInputStream& is) override
   {
     serialization::Deserialize(is, tGenericObject::GetData<T>());
@@ -112,16 +102,6 @@ public:
   }
 #endif
 
-  virtual bool Equals(const tGenericObject& other) override
-  {
-    return wrapped == other.GetRawDataPointer() || (GetType() == other.GetType() && GenericOperations<T>::Equals(this->GetData<T>(), other.GetData<T>()));
-  }
-
-  virtual void Serialize(serialization::tOutputStream& os) const override
-  {
-    serialization::Serialize(os, tGenericObject::GetData<T>());
-  }
-
   virtual void Serialize(serialization::tStringOutputStream& os) const override
   {
     serialization::Serialize(os, tGenericObject::GetData<T>());
@@ -143,16 +123,6 @@ protected:
     tGenericObject(tDataType<T>())
   {}
 
-//----------------------------------------------------------------------
-// Private fields and methods
-//----------------------------------------------------------------------
-private:
-
-  virtual void DeepCopyFrom(const void* source, tFactory* f) override
-  {
-    DeepCopyFromImpl(*static_cast<const T*>(source), f);
-  }
-
 };
 
 //----------------------------------------------------------------------
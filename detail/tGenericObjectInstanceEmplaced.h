@@ -65,6 +65,7 @@ namespace detail
 /*!
  * A generic object that receives memory to initialize an object T in - and wrap it.
  * Memory block needs to have size sizeof(T)
+ * Whether T is destructed together with the generic object is specified on construction.
  */
 template<typename T, bool NO_ARG_CONSTRUCTOR = std::is_base_of<serialization::DefaultImplementation, serialization::DefaultInstantiation<T>>::value>
 class tGenericObjectInstanceEmplaced : public detail::tGenericObjectBaseImpl<T>
@@ -75,13 +76,33 @@ class tGenericObjectInstanceEmplaced : public detail::tGenericObjectBaseImpl<T>
 //----------------------------------------------------------------------
 public:
 
-  tGenericObjectInstanceEmplaced(void* address) :
-    detail::tGenericObjectBaseImpl<T>()
+  /*!
+   * \param address Address to construct T at
+   * \param destruct_data Whether to destruct T when this generic object is destructed
+   */
+  tGenericObjectInstanceEmplaced(void* address, bool destruct_data = false) :
+    detail::tGenericObjectBaseImpl<T>(),
+    destruct_data(destruct_data)
   {
     new(address) T(serialization::DefaultInstantiation<T>::Create());
     tGenericObject::wrapped = address;
   }
 
+  virtual ~tGenericObjectInstanceEmplaced()
+  {
+    if (destruct_data)
+    {
+      static_cast<T*>(tGenericObject::wrapped)->~T();
+    }
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Whether to destruct T when this generic object is destructed */
+  const bool destruct_data;
 };
 
 // Specialization for when default constructor is available
@@ -94,13 +115,33 @@ class tGenericObjectInstanceEmplaced<T, true> : public detail::tGenericObjectBas
 //----------------------------------------------------------------------
 public:
 
-  tGenericObjectInstanceEmplaced(void* address) :
-    detail::tGenericObjectBaseImpl<T>()
+  /*!
+   * \param address Address to construct T at
+   * \param destruct_data Whether to destruct T when this generic object is destructed
+   */
+  tGenericObjectInstanceEmplaced(void* address, bool destruct_data = false) :
+    detail::tGenericObjectBaseImpl<T>(),
+    destruct_data(destruct_data)
   {
     new(address) T();
     tGenericObject::wrapped = address;
   }
 
+  virtual ~tGenericObjectInstanceEmplaced()
+  {
+    if (destruct_data)
+    {
+      static_cast<T*>(tGenericObject::wrapped)->~T();
+    }
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Whether to destruct T when this generic object is destructed */
+  const bool destruct_data;
 };
 
 //----------------------------------------------------------------------
@@ -0,0 +1,310 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti/detail/tMultiPatternReplacer.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/rtti/detail/tMultiPatternReplacer.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <cctype>
+#include <deque>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace detail
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+static inline bool IsAlphanumeric(char c)
+{
+  return isalnum(static_cast<unsigned char>(c));
+}
+
+tMultiPatternReplacer::tMultiPatternReplacer() :
+  nodes(),
+  pattern_count(0),
+  links_outdated(false),
+  deferring_link_updates(0)
+{
+  nodes.emplace_back(0);
+}
+
+bool tMultiPatternReplacer::AddPattern(const std::string& pattern, const std::string& replacement)
+{
+  if (pattern.length() == 0)
+  {
+    return false;
+  }
+
+  unsigned int node = 0;
+  for (char c : pattern)
+  {
+    auto it = nodes[node].children.find(c);
+    if (it != nodes[node].children.end())
+    {
+      node = it->second;
+    }
+    else
+    {
+      unsigned int new_node = static_cast<unsigned int>(nodes.size());
+      nodes.emplace_back(nodes[node].depth + 1);
+      nodes[node].children.emplace(c, new_node);
+      node = new_node;
+      links_outdated = true;
+    }
+  }
+
+  if (nodes[node].pattern_end)
+  {
+    return false;
+  }
+  nodes[node].pattern_end = true;
+  nodes[node].replacement = replacement;
+  pattern_count++;
+  links_outdated = true;
+  return true;
+}
+
+unsigned int tMultiPatternReplacer::FindNode(const std::string& pattern) const
+{
+  unsigned int node = 0;
+  for (char c : pattern)
+  {
+    auto it = nodes[node].children.find(c);
+    if (it == nodes[node].children.end())
+    {
+      return 0;
+    }
+    node = it->second;
+  }
+  return node;
+}
+
+bool tMultiPatternReplacer::RemovePattern(const std::string& pattern)
+{
+  unsigned int node = FindNode(pattern);
+  if (node == 0 || (!nodes[node].pattern_end))
+  {
+    return false;
+  }
+  nodes[node].pattern_end = false;
+  nodes[node].replacement.clear();
+  pattern_count--;
+  links_outdated = true;
+  return true;
+}
+
+bool tMultiPatternReplacer::Replace(std::string& text)
+{
+  if (pattern_count == 0)
+  {
+    return false;
+  }
+
+  // Find all occurrences (start index, node)
+  std::vector<std::pair<size_t, unsigned int>> occurrences;
+  if (links_outdated && deferring_link_updates)
+  {
+    FindOccurrencesWithoutLinks(text, occurrences);
+  }
+  else
+  {
+    if (links_outdated)
+    {
+      UpdateLinks();
+    }
+    FindOccurrences(text, occurrences);
+  }
+
+  if (occurrences.empty())
+  {
+    return false;
+  }
+
+  // Replace leftmost (and longest) occurrences
+  std::sort(occurrences.begin(), occurrences.end(), [this](const std::pair<size_t, unsigned int>& lhs, const std::pair<size_t, unsigned int>& rhs)
+  {
+    return lhs.first != rhs.first ? lhs.first < rhs.first : nodes[lhs.second].depth > nodes[rhs.second].depth;
+  });
+  std::string result;
+  result.reserve(text.length());
+  size_t position = 0;
+  for (auto & occurrence : occurrences)
+  {
+    if (occurrence.first < position)
+    {
+      continue;
+    }
+    result.append(text, position, occurrence.first - position);
+    result.append(nodes[occurrence.second].replacement);
+    position = occurrence.first + nodes[occurrence.second].depth;
+  }
+  result.append(text, position, std::string::npos);
+  text.swap(result);
+  return true;
+}
+
+void tMultiPatternReplacer::FindOccurrences(const std::string& text, std::vector<std::pair<size_t, unsigned int>>& occurrences) const
+{
+  unsigned int state = 0;
+  for (size_t i = 0; i < text.length(); i++)
+  {
+    char c = text[i];
+    while (true)
+    {
+      auto it = nodes[state].children.find(c);
+      if (it != nodes[state].children.end())
+      {
+        state = it->second;
+        break;
+      }
+      if (state == 0)
+      {
+        break;
+      }
+      state = nodes[state].failure;
+    }
+
+    size_t end = i + 1;
+    if (end >= text.length() || IsAlphanumeric(text[end]))
+    {
+      continue;
+    }
+    for (unsigned int node = nodes[state].pattern_end ? state : nodes[state].output; node != 0; node = nodes[node].output)
+    {
+      size_t start = end - nodes[node].depth;
+      if (start > 0 && (!IsAlphanumeric(text[start - 1])))
+      {
+        occurrences.emplace_back(start, node);
+      }
+    }
+  }
+}
+
+void tMultiPatternReplacer::FindOccurrencesWithoutLinks(const std::string& text, std::vector<std::pair<size_t, unsigned int>>& occurrences) const
+{
+  for (size_t start = 1; start < text.length(); start++)
+  {
+    if (IsAlphanumeric(text[start - 1]))
+    {
+      continue;
+    }
+    unsigned int node = 0;
+    for (size_t end = start + 1; end < text.length(); end++)
+    {
+      auto it = nodes[node].children.find(text[end - 1]);
+      if (it == nodes[node].children.end())
+      {
+        break;
+      }
+      node = it->second;
+      if (nodes[node].pattern_end && (!IsAlphanumeric(text[end])))
+      {
+        occurrences.emplace_back(start, node);
+      }
+    }
+  }
+}
+
+void tMultiPatternReplacer::UpdateLinks()
+{
+  std::deque<unsigned int> queue;
+  for (auto & child : nodes[0].children)
+  {
+    nodes[child.second].failure = 0;
+    nodes[child.second].output = 0;
+    queue.push_back(child.second);
+  }
+
+  while (!queue.empty())
+  {
+    unsigned int node = queue.front();
+    queue.pop_front();
+    for (auto & child : nodes[node].children)
+    {
+      unsigned int failure = nodes[node].failure;
+      while (true)
+      {
+        auto it = nodes[failure].children.find(child.first);
+        if (it != nodes[failure].children.end())
+        {
+          failure = it->second;
+          break;
+        }
+        if (failure == 0)
+        {
+          break;
+        }
+        failure = nodes[failure].failure;
+      }
+      assert(failure != child.second);
+      nodes[child.second].failure = failure;
+      nodes[child.second].output = nodes[failure].pattern_end ? failure : nodes[failure].output;
+      queue.push_back(child.second);
+    }
+  }
+  links_outdated = false;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
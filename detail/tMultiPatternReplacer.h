@@ -0,0 +1,230 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti/detail/tMultiPatternReplacer.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tMultiPatternReplacer
+ *
+ * \b tMultiPatternReplacer
+ *
+ * Replaces occurrences of many patterns in a string in a single pass
+ * (using an Aho-Corasick automaton).
+ * Used to substitute demangled names of renamed types in type names.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__rtti__detail__tMultiPatternReplacer_h__
+#define __rrlib__rtti__detail__tMultiPatternReplacer_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <map>
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace detail
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Replaces many patterns in a single pass
+/*!
+ * Replaces occurrences of many patterns in a string in a single pass
+ * (using an Aho-Corasick automaton).
+ *
+ * Only whole words are replaced (characters before and after occurrence must not be alphanumeric).
+ * As in type names only template arguments are to be replaced, occurrences at the very beginning
+ * or end of a string are not replaced either.
+ * If occurrences overlap, the leftmost one is replaced - and the longest one if several start at the same position.
+ *
+ * Patterns are inserted into the trie incrementally.
+ * Failure links are (re)computed on the first call to Replace() after patterns have been added or removed.
+ * When many patterns are added (e.g. in a registration batch), recomputation can be deferred
+ * (see BeginDeferringLinkUpdates()). Meanwhile, Replace() matches patterns by walking the trie from every
+ * word start - which does not require failure links.
+ */
+class tMultiPatternReplacer
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  tMultiPatternReplacer();
+
+  /*!
+   * Adds pattern
+   *
+   * \param pattern Pattern to replace
+   * \param replacement String to replace pattern with
+   * \return True if pattern was added. False if such a pattern has already been added (existing replacement is kept)
+   */
+  bool AddPattern(const std::string& pattern, const std::string& replacement);
+
+  /*!
+   * Defers recomputation of failure links until EndDeferringLinkUpdates() is called
+   * (calls may be nested)
+   */
+  void BeginDeferringLinkUpdates()
+  {
+    deferring_link_updates++;
+  }
+
+  /*!
+   * Ends deferring recomputation of failure links (see BeginDeferringLinkUpdates()).
+   * Links are recomputed on the next call to Replace().
+   */
+  void EndDeferringLinkUpdates()
+  {
+    assert(deferring_link_updates > 0);
+    deferring_link_updates--;
+  }
+
+  /*!
+   * \return Number of patterns
+   */
+  size_t GetPatternCount() const
+  {
+    return pattern_count;
+  }
+
+  /*!
+   * Removes pattern
+   *
+   * \param pattern Pattern to remove
+   * \return True if pattern was found and removed
+   */
+  bool RemovePattern(const std::string& pattern);
+
+  /*!
+   * Replaces all occurrences of patterns in string
+   *
+   * \param text String to replace patterns in
+   * \return Whether any pattern was replaced
+   */
+  bool Replace(std::string& text);
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Node of trie */
+  struct tNode
+  {
+    /*! Child nodes */
+    std::map<char, unsigned int> children;
+
+    /*! Failure link: node representing longest proper suffix that is also in trie */
+    unsigned int failure;
+
+    /*! Next node reachable via failure links that completes a pattern (0 if there is none) */
+    unsigned int output;
+
+    /*! Depth of node (= length of pattern if node completes a pattern) */
+    unsigned int depth;
+
+    /*! Whether node completes a pattern */
+    bool pattern_end;
+
+    /*! Replacement for pattern that ends in this node */
+    std::string replacement;
+
+    tNode(unsigned int depth) : children(), failure(0), output(0), depth(depth), pattern_end(false), replacement()
+    {}
+  };
+
+  /*! Nodes of trie (root node has index 0) */
+  std::vector<tNode> nodes;
+
+  /*! Number of patterns */
+  size_t pattern_count;
+
+  /*! True if failure links need to be recomputed */
+  bool links_outdated;
+
+  /*! Number of BeginDeferringLinkUpdates() calls without matching EndDeferringLinkUpdates() call */
+  unsigned int deferring_link_updates;
+
+  /*!
+   * \param pattern Pattern to find
+   * \return Index of node in trie that represents pattern (0 if there is none)
+   */
+  unsigned int FindNode(const std::string& pattern) const;
+
+  /*!
+   * Finds occurrences using failure links (in a single pass)
+   *
+   * \param text String to find patterns in
+   * \param occurrences Vector to add occurrences to (start index, node)
+   */
+  void FindOccurrences(const std::string& text, std::vector<std::pair<size_t, unsigned int>>& occurrences) const;
+
+  /*!
+   * Finds occurrences without failure links (by walking the trie from every word start)
+   *
+   * \param text String to find patterns in
+   * \param occurrences Vector to add occurrences to (start index, node)
+   */
+  void FindOccurrencesWithoutLinks(const std::string& text, std::vector<std::pair<size_t, unsigned int>>& occurrences) const;
+
+  /*!
+   * Computes failure and output links (breadth-first)
+   */
+  void UpdateLinks();
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
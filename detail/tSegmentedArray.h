@@ -0,0 +1,169 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti/detail/tSegmentedArray.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tSegmentedArray
+ *
+ * \b tSegmentedArray
+ *
+ * Array that grows in segments of fixed size.
+ * Segments are never moved or deleted while the array exists.
+ * Therefore, readers may access elements without any locking while a
+ * (single or externally synchronized) writer adds segments.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__rtti__detail__tSegmentedArray_h__
+#define __rrlib__rtti__detail__tSegmentedArray_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <atomic>
+#include <cstddef>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace detail
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Array growing in segments
+/*!
+ * Array that grows in segments of fixed size.
+ * Segments are never moved or deleted while the array exists.
+ * Therefore, readers may access elements without any locking while a
+ * (single or externally synchronized) writer adds segments.
+ *
+ * \tparam T Element type (must be default-constructible)
+ * \tparam SEGMENT_SIZE Number of elements per segment
+ * \tparam MAX_SIZE Maximum number of elements
+ */
+template <typename T, size_t SEGMENT_SIZE, size_t MAX_SIZE>
+class tSegmentedArray
+{
+  static_assert(MAX_SIZE % SEGMENT_SIZE == 0, "MAX_SIZE must be a multiple of SEGMENT_SIZE");
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  tSegmentedArray()
+  {
+    for (size_t i = 0; i < cSEGMENT_COUNT; i++)
+    {
+      segments[i].store(nullptr, std::memory_order_relaxed);
+    }
+  }
+
+  ~tSegmentedArray()
+  {
+    for (size_t i = 0; i < cSEGMENT_COUNT; i++)
+    {
+      delete[] segments[i].load(std::memory_order_relaxed);
+    }
+  }
+
+  /*!
+   * (may be called concurrently to writer)
+   *
+   * \param index Index of element
+   * \return Pointer to element - or nullptr if index is out of bounds or no segment has been allocated for it
+   */
+  inline T* Find(size_t index) const
+  {
+    if (index >= MAX_SIZE)
+    {
+      return nullptr;
+    }
+    T* segment = segments[index / SEGMENT_SIZE].load(std::memory_order_acquire);
+    return segment ? &segment[index % SEGMENT_SIZE] : nullptr;
+  }
+
+  /*!
+   * Obtains element - allocating segment if required
+   * (calls must be synchronized among writers)
+   *
+   * \param index Index of element (must be smaller than MAX_SIZE)
+   * \return Element at this index
+   */
+  T& GetOrCreate(size_t index)
+  {
+    std::atomic<T*>& segment_pointer = segments[index / SEGMENT_SIZE];
+    T* segment = segment_pointer.load(std::memory_order_relaxed);
+    if (!segment)
+    {
+      segment = new T[SEGMENT_SIZE]();
+      segment_pointer.store(segment, std::memory_order_release);
+    }
+    return segment[index % SEGMENT_SIZE];
+  }
+
+  /*!
+   * Element access for index whose segment is known to exist
+   * (e.g. because index is smaller than a published size)
+   */
+  inline T& operator[](size_t index) const
+  {
+    return segments[index / SEGMENT_SIZE].load(std::memory_order_acquire)[index % SEGMENT_SIZE];
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  enum { cSEGMENT_COUNT = MAX_SIZE / SEGMENT_SIZE };
+
+  /*! Pointers to segments (nullptr if segment has not been allocated yet) */
+  std::atomic<T*> segments[cSEGMENT_COUNT];
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
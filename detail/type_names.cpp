@@ -0,0 +1,327 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti/detail/type_names.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/rtti/detail/type_names.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cctype>
+#include <cstring>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace detail
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+namespace
+{
+
+/*! Token in demangled type name */
+struct tToken
+{
+  enum tType { TEXT, OPEN, CLOSE, SEPARATOR };
+
+  /*! Type of token */
+  tType type;
+
+  /*! Range of token in type name */
+  size_t begin, end;
+};
+
+/*!
+ * Node of syntax tree.
+ * An item is a (template) argument or the whole type name. It consists of segments.
+ * A segment is a piece of text - optionally followed by template arguments in angle brackets (which are items).
+ */
+struct tNode
+{
+  /*! Is this node an item? (otherwise it is a segment) */
+  bool item;
+
+  /*! Range of text (segment) or start of item in type name */
+  size_t begin, end;
+
+  /*! Does segment have template arguments? */
+  bool has_arguments;
+
+  /*! Are template arguments closed with '>'? */
+  bool closed;
+
+  /*! Child nodes (segments of item or arguments of segment) */
+  std::vector<unsigned int> children;
+
+  tNode(bool item, size_t begin, size_t end) : item(item), begin(begin), end(end), has_arguments(false), closed(false), children()
+  {}
+};
+
+/*!
+ * Parses demangled type name and writes rrlib::rtti container names
+ */
+class tParser
+{
+public:
+
+  tParser(const std::string& name, const tContainerNameMapping* mappings, size_t mapping_count) :
+    name(name),
+    mappings(mappings),
+    mapping_count(mapping_count),
+    tokens(),
+    next_token(0),
+    nodes()
+  {
+    Tokenize();
+  }
+
+  std::string Run()
+  {
+    unsigned int root = ParseItem(0, 0);
+    std::string result;
+    result.reserve(name.length());
+    Write(root, result);
+    return result;
+  }
+
+private:
+
+  const std::string& name;
+  const tContainerNameMapping* mappings;
+  const size_t mapping_count;
+  std::vector<tToken> tokens;
+  size_t next_token;
+  std::vector<tNode> nodes;
+
+  void Tokenize()
+  {
+    size_t text_begin = 0;
+    for (size_t i = 0; i < name.length(); i++)
+    {
+      char c = name[i];
+      if (c == '<' || c == '>' || c == ',')
+      {
+        if (i > text_begin)
+        {
+          tokens.push_back(tToken { tToken::TEXT, text_begin, i });
+        }
+        tokens.push_back(tToken { c == '<' ? tToken::OPEN : (c == '>' ? tToken::CLOSE : tToken::SEPARATOR), i, i + 1 });
+        text_begin = i + 1;
+      }
+    }
+    if (name.length() > text_begin)
+    {
+      tokens.push_back(tToken { tToken::TEXT, text_begin, name.length() });
+    }
+  }
+
+  /*!
+   * \param depth Nesting depth (0 is whole type name)
+   * \param begin Start of item in type name
+   * \return Index of parsed item node
+   */
+  unsigned int ParseItem(size_t depth, size_t begin)
+  {
+    unsigned int item = static_cast<unsigned int>(nodes.size());
+    nodes.emplace_back(true, begin, begin);
+    while (next_token < tokens.size())
+    {
+      const tToken token = tokens[next_token];
+      if (token.type == tToken::TEXT || (depth == 0 && token.type != tToken::OPEN)) // at top level, ',' and '>' are plain text
+      {
+        next_token++;
+        unsigned int segment = static_cast<unsigned int>(nodes.size());
+        nodes.emplace_back(false, token.begin, token.end);
+        nodes[item].children.push_back(segment);
+        if (next_token < tokens.size() && tokens[next_token].type == tToken::OPEN)
+        {
+          ParseArguments(segment, depth);
+        }
+      }
+      else if (token.type == tToken::OPEN)
+      {
+        unsigned int segment = static_cast<unsigned int>(nodes.size());
+        nodes.emplace_back(false, token.begin, token.begin);
+        nodes[item].children.push_back(segment);
+        ParseArguments(segment, depth);
+      }
+      else
+      {
+        break; // ',' or '>' ends argument
+      }
+    }
+    return item;
+  }
+
+  /*!
+   * Parses template arguments (next token is '<')
+   */
+  void ParseArguments(unsigned int segment, size_t depth)
+  {
+    assert(tokens[next_token].type == tToken::OPEN);
+    size_t argument_begin = tokens[next_token].end;
+    next_token++;
+    nodes[segment].has_arguments = true;
+    while (true)
+    {
+      unsigned int argument = ParseItem(depth + 1, argument_begin);
+      nodes[segment].children.push_back(argument);
+      if (next_token >= tokens.size())
+      {
+        return;
+      }
+      const tToken token = tokens[next_token];
+      next_token++;
+      if (token.type == tToken::CLOSE)
+      {
+        nodes[segment].closed = true;
+        return;
+      }
+      assert(token.type == tToken::SEPARATOR);
+      argument_begin = token.end;
+    }
+  }
+
+  /*!
+   * \return Mapping for container whose name the text of segment ends with (nullptr if there is none)
+   */
+  const tContainerNameMapping* FindMapping(const tNode& segment, size_t& name_start) const
+  {
+    for (size_t i = 0; i < mapping_count; i++)
+    {
+      size_t length = strlen(mappings[i].cpp_name);
+      if (segment.end - segment.begin >= length && name.compare(segment.end - length, length, mappings[i].cpp_name) == 0 &&
+          (segment.end == length || (!isalnum(static_cast<unsigned char>(name[segment.end - length - 1])))))
+      {
+        name_start = segment.end - length;
+        return &mappings[i];
+      }
+    }
+    return nullptr;
+  }
+
+  void Write(unsigned int node_index, std::string& result) const
+  {
+    static const char* cALLOCATOR = "std::allocator<";
+    static const size_t cALLOCATOR_LENGTH = strlen(cALLOCATOR);
+
+    const tNode& node = nodes[node_index];
+    if (node.item)
+    {
+      for (unsigned int segment : node.children)
+      {
+        Write(segment, result);
+      }
+      return;
+    }
+
+    size_t argument_count = node.children.size();
+    const tContainerNameMapping* mapping = nullptr;
+    size_t name_start = 0;
+    if (node.has_arguments && node.closed && argument_count >= 2)
+    {
+      mapping = FindMapping(node, name_start);
+    }
+
+    if (mapping)
+    {
+      result.append(name, node.begin, name_start - node.begin);
+      result.append(mapping->rtti_name);
+      size_t last_argument_begin = nodes[node.children.back()].begin;
+      if (name.compare(last_argument_begin, cALLOCATOR_LENGTH, cALLOCATOR) == 0 || name.compare(last_argument_begin + 1, cALLOCATOR_LENGTH, cALLOCATOR) == 0)
+      {
+        argument_count--;
+      }
+    }
+    else
+    {
+      result.append(name, node.begin, node.end - node.begin);
+    }
+
+    if (node.has_arguments)
+    {
+      result += '<';
+      for (size_t i = 0; i < argument_count; i++)
+      {
+        if (i > 0)
+        {
+          result += ',';
+        }
+        Write(node.children[i], result);
+      }
+      if (node.closed)
+      {
+        result += '>';
+      }
+    }
+  }
+};
+
+}
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+std::string ReplaceContainerNames(const std::string& demangled_name, const tContainerNameMapping* mappings, size_t mapping_count)
+{
+  return tParser(demangled_name, mappings, mapping_count).Run();
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
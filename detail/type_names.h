@@ -0,0 +1,308 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti/detail/type_names.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * Parsing and rewriting of demangled type names.
+ * Computation of type names at compile time.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__rtti__detail__type_names_h__
+#define __rrlib__rtti__detail__type_names_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace detail
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*!
+ * Maps name of C++ container template to name in rrlib::rtti format
+ */
+struct tContainerNameMapping
+{
+  /*! Name of C++ template (e.g. "std::vector") */
+  const char* cpp_name;
+
+  /*! Name in rrlib::rtti format (e.g. "List") */
+  const char* rtti_name;
+};
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+/*!
+ * Replaces std container names in demangled type name (e.g. "std::vector<int, std::allocator<int> >" becomes "List<int>").
+ *
+ * The name is tokenized and parsed into a small syntax tree in one pass, which is then written to the result in a second pass.
+ * Containers are mapped as specified in the table passed; further containers can be supported by adding entries.
+ * A container is only renamed if it has at least two template arguments - and its last argument is removed if it is a std::allocator.
+ *
+ * \param demangled_name Demangled type name
+ * \param mappings Container mappings to apply
+ * \param mapping_count Number of entries in 'mappings'
+ * \return Type name with containers replaced
+ */
+std::string ReplaceContainerNames(const std::string& demangled_name, const tContainerNameMapping* mappings, size_t mapping_count);
+
+/*!
+ * Adds type name computed at compile time to the cache of tType::GetTypeNameFromRtti()
+ * (so that the rtti name of the type need not be demangled at runtime)
+ *
+ * \param rtti_name Rtti name of type
+ * \param demangled_name Demangled rtti name of type (not null-terminated)
+ * \param demangled_name_length Length of demangled name
+ * \param name Name of type in rrlib_rtti format
+ * \return Name of type (as returned by tType::GetTypeNameFromRtti)
+ */
+std::string AddCompileTimeTypeName(const char* rtti_name, const char* demangled_name, size_t demangled_name_length, const char* name);
+
+//----------------------------------------------------------------------
+// Compile-time type names
+//----------------------------------------------------------------------
+
+/*! Function signature as provided by the compiler */
+struct tFunctionSignature
+{
+  const char* text;
+  size_t length;
+
+  constexpr tFunctionSignature(const char* text, size_t length) : text(text), length(length)
+  {}
+};
+
+/*!
+ * Signature of function that contains the type name of T
+ * (e.g. "static constexpr rrlib::rtti::detail::tFunctionSignature rrlib::rtti::detail::tTypeSignature<T>::Get() [with T = rrlib::rtti::tType]" with gcc)
+ */
+template <typename T>
+struct tTypeSignature
+{
+  static constexpr tFunctionSignature Get()
+  {
+#ifdef __GNUC__
+    return tFunctionSignature(__PRETTY_FUNCTION__, sizeof(__PRETTY_FUNCTION__) - 1);
+#else
+    return tFunctionSignature("", 0);
+#endif
+  }
+};
+
+namespace compile_time
+{
+
+/*! Maximum length of type names computed at compile time (limits recursion depth of constexpr functions) */
+enum { cMAX_NAME_LENGTH = 200 };
+
+constexpr bool IsUpper(char c)
+{
+  return c >= 'A' && c <= 'Z';
+}
+
+constexpr bool IsAlphanumeric(char c)
+{
+  return IsUpper(c) || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9');
+}
+
+/*!
+ * \return Start of type name in signature: index after last " = " before 'end' (0 if it is not found within cMAX_NAME_LENGTH characters)
+ */
+constexpr size_t FindNameBegin(const char* signature, size_t end, size_t remaining)
+{
+  return (remaining == 0 || end < 3) ? 0 :
+         ((signature[end - 3] == ' ' && signature[end - 2] == '=' && signature[end - 1] == ' ') ? end : FindNameBegin(signature, end - 1, remaining - 1));
+}
+
+/*!
+ * \return Whether name contains characters indicating templates, anonymous namespaces, local classes etc. (not handled at compile time)
+ */
+constexpr bool ContainsUnsupportedCharacter(const char* name, size_t begin, size_t end)
+{
+  return begin < end && (name[begin] == '<' || name[begin] == '(' || name[begin] == '{' || name[begin] == '[' || name[begin] == ' ' || name[begin] == ',' ||
+                         ContainsUnsupportedCharacter(name, begin + 1, end));
+}
+
+// The following functions transform the demangled name the same way as tType::GetTypeNameFromRtti():
+// '::' is replaced with '.' and 't' prefixes are removed. Each step writes one character of the result.
+
+constexpr bool IsNamespaceSeparator(const char* name, size_t index, size_t end)
+{
+  return index + 1 < end && name[index] == ':' && name[index + 1] == ':';
+}
+
+constexpr bool IsRemovedPrefix(const char* name, size_t index, size_t end, bool word_start)
+{
+  return index + 1 < end && word_start && name[index] == 't' && IsUpper(name[index + 1]);
+}
+
+constexpr size_t NextIndex(const char* name, size_t index, size_t end, bool word_start)
+{
+  return (IsNamespaceSeparator(name, index, end) || IsRemovedPrefix(name, index, end, word_start)) ? index + 2 : index + 1;
+}
+
+constexpr bool NextWordStart(const char* name, size_t index, size_t end, bool word_start)
+{
+  return IsNamespaceSeparator(name, index, end) || (!IsAlphanumeric(name[NextIndex(name, index, end, word_start) - 1]));
+}
+
+constexpr char OutputCharacter(const char* name, size_t index, size_t end, bool word_start)
+{
+  return IsNamespaceSeparator(name, index, end) ? '.' : name[NextIndex(name, index, end, word_start) - 1];
+}
+
+constexpr size_t NameLength(const char* name, size_t index, size_t end, bool word_start)
+{
+  return index >= end ? 0 : 1 + NameLength(name, NextIndex(name, index, end, word_start), end, NextWordStart(name, index, end, word_start));
+}
+
+constexpr char NameCharacter(const char* name, size_t index, size_t end, bool word_start, size_t character_index)
+{
+  return character_index == 0 ? OutputCharacter(name, index, end, word_start) :
+         NameCharacter(name, NextIndex(name, index, end, word_start), end, NextWordStart(name, index, end, word_start), character_index - 1);
+}
+
+template <size_t... INDICES>
+struct tIndexSequence
+{};
+
+template <size_t N, size_t... INDICES>
+struct tMakeIndexSequence : tMakeIndexSequence < N - 1, N - 1, INDICES... >
+{};
+
+template <size_t... INDICES>
+struct tMakeIndexSequence<0, INDICES...>
+{
+  typedef tIndexSequence<INDICES...> type;
+};
+
+template <typename T, typename INDICES>
+struct tNameCharacters;
+
+} // namespace compile_time
+
+/*!
+ * Type name of T in rrlib_rtti format - computed at compile time from the compiler's function signature string.
+ *
+ * Only available for (non-template) classes and enums with supported compilers (gcc and clang) - as
+ * types renamed at runtime may only change names of template types.
+ * For other types, tType::GetTypeNameFromRtti() needs to be used.
+ */
+template <typename T>
+struct tCompileTimeTypeName
+{
+  static constexpr const char* Signature()
+  {
+    return tTypeSignature<T>::Get().text;
+  }
+
+  /*! End of type name in signature */
+  static constexpr size_t End()
+  {
+    return tTypeSignature<T>::Get().length > 0 && Signature()[tTypeSignature<T>::Get().length - 1] == ']' ? tTypeSignature<T>::Get().length - 1 : 0;
+  }
+
+  /*! Start of type name in signature */
+  static constexpr size_t Begin()
+  {
+    return compile_time::FindNameBegin(Signature(), End(), compile_time::cMAX_NAME_LENGTH + 1);
+  }
+
+  /*! Is name available at compile time? */
+  static constexpr bool cAVAILABLE = (std::is_class<T>::value || std::is_enum<T>::value) && Begin() > 0 && Begin() < End() &&
+                                     (!compile_time::ContainsUnsupportedCharacter(Signature(), Begin(), End()));
+
+  /*! Length of name (0 if not available) */
+  static constexpr size_t cLENGTH = cAVAILABLE ? compile_time::NameLength(Signature(), Begin(), End(), true) : 0;
+
+  /*!
+   * \return Type name in rrlib_rtti format (empty string if not available)
+   */
+  static constexpr const char* Get();
+
+  /*!
+   * \return Demangled name of T (not null-terminated; length is End() - Begin())
+   */
+  static constexpr const char* GetDemangled()
+  {
+    return Signature() + Begin();
+  }
+};
+
+template <typename T>
+constexpr bool tCompileTimeTypeName<T>::cAVAILABLE;
+
+template <typename T>
+constexpr size_t tCompileTimeTypeName<T>::cLENGTH;
+
+namespace compile_time
+{
+
+template <typename T, size_t... INDICES>
+struct tNameCharacters<T, tIndexSequence<INDICES...>>
+{
+  static constexpr char value[sizeof...(INDICES) + 1] = { NameCharacter(tCompileTimeTypeName<T>::Signature(), tCompileTimeTypeName<T>::Begin(), tCompileTimeTypeName<T>::End(), true, INDICES)..., '\0' };
+};
+
+template <typename T, size_t... INDICES>
+constexpr char tNameCharacters<T, tIndexSequence<INDICES...>>::value[sizeof...(INDICES) + 1];
+
+} // namespace compile_time
+
+template <typename T>
+constexpr const char* tCompileTimeTypeName<T>::Get()
+{
+  return compile_time::tNameCharacters<T, typename compile_time::tMakeIndexSequence<cLENGTH>::type>::value;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
@@ -0,0 +1,277 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti/registration_profiling.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/rtti/registration_profiling.h"
+
+#if RRLIB_RTTI_REGISTRATION_PROFILING_ENABLED
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+/*! Column titles of printed profiles (index is tRegistrationPhase) */
+static const char* cPHASE_TITLES[] = { "construction", "names", "binary", "init", "mutex wait" };
+static_assert(sizeof(cPHASE_TITLES) / sizeof(cPHASE_TITLES[0]) == static_cast<size_t>(tRegistrationPhase::DIMENSION), "Titles do not match phases");
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+
+/*!
+ * Profiles collected so far.
+ * Deliberately never deleted, as types may still be registered during static deinitialization.
+ */
+struct tProfiles
+{
+  std::mutex mutex;
+
+  /*! Profiles of registered types */
+  std::vector<tRegistrationProfile> completed;
+
+  /*! Profiles of types whose info has been constructed - but that have not been registered yet (key is info) */
+  std::unordered_map<const void*, tRegistrationProfile> pending;
+
+  /*! Whether profiles are printed at exit */
+  bool print_at_exit = false;
+};
+
+tProfiles& GetProfiles()
+{
+  static tProfiles* profiles = new tProfiles();
+  return *profiles;
+}
+
+/*! Records of types currently constructed or registered by this thread */
+std::vector<tRegistrationProfile>& GetThreadStack()
+{
+  static thread_local std::vector<tRegistrationProfile> stack;
+  return stack;
+}
+
+double ToMilliseconds(std::chrono::nanoseconds duration)
+{
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+void PrintAtExit()
+{
+  PrintRegistrationProfiles(std::cerr);
+}
+
+}
+
+tRegistrationProfile::tRegistrationProfile() :
+  type_name(),
+  binary(),
+  uid(-1),
+  start(std::chrono::steady_clock::now())
+{
+  for (auto & duration : durations)
+  {
+    duration = std::chrono::nanoseconds::zero();
+  }
+}
+
+std::vector<tRegistrationProfile> GetRegistrationProfiles()
+{
+  tProfiles& profiles = GetProfiles();
+  std::unique_lock<std::mutex> lock(profiles.mutex);
+  return profiles.completed;
+}
+
+void PrintRegistrationProfiles(std::ostream& stream)
+{
+  std::map<std::string, std::vector<tRegistrationProfile>> by_binary;
+  for (auto & profile : GetRegistrationProfiles())
+  {
+    by_binary[profile.binary].push_back(profile);
+  }
+
+  stream << "Type registration profile (durations in ms):" << std::endl;
+  for (auto & binary : by_binary)
+  {
+    std::chrono::nanoseconds totals[static_cast<size_t>(tRegistrationPhase::DIMENSION)] = {};
+    for (auto & profile : binary.second)
+    {
+      for (size_t i = 0; i < static_cast<size_t>(tRegistrationPhase::DIMENSION); i++)
+      {
+        totals[i] += profile.durations[i];
+      }
+    }
+
+    stream << std::endl << "Binary '" << (binary.first.length() ? binary.first : "<registered dynamically>") << "': " << binary.second.size() << " types" << std::endl;
+    stream << "  " << std::setw(6) << "uid";
+    for (const char* title : cPHASE_TITLES)
+    {
+      stream << std::setw(14) << title;
+    }
+    stream << "  type" << std::endl;
+    stream << std::fixed << std::setprecision(3);
+    for (auto & profile : binary.second)
+    {
+      stream << "  " << std::setw(6) << profile.uid;
+      for (auto & duration : profile.durations)
+      {
+        stream << std::setw(14) << ToMilliseconds(duration);
+      }
+      stream << "  " << profile.type_name << std::endl;
+    }
+    stream << "  " << std::setw(6) << "total";
+    for (auto & total : totals)
+    {
+      stream << std::setw(14) << ToMilliseconds(total);
+    }
+    stream << std::endl;
+    stream.unsetf(std::ios_base::floatfield);
+  }
+}
+
+void PrintRegistrationProfilesAtExit()
+{
+  tProfiles& profiles = GetProfiles();
+  std::unique_lock<std::mutex> lock(profiles.mutex);
+  if (!profiles.print_at_exit)
+  {
+    profiles.print_at_exit = true;
+    std::atexit(&PrintAtExit);
+  }
+}
+
+namespace detail
+{
+
+void tRegistrationProfiler::BeginInfoConstruction()
+{
+  GetThreadStack().emplace_back();
+}
+
+void tRegistrationProfiler::EndInfoConstruction(const void* info)
+{
+  auto& stack = GetThreadStack();
+  assert(stack.size());
+  tRegistrationProfile& profile = stack.back();
+  profile.durations[static_cast<size_t>(tRegistrationPhase::INFO_CONSTRUCTION)] = std::chrono::steady_clock::now() - profile.start;
+
+  tProfiles& profiles = GetProfiles();
+  {
+    std::unique_lock<std::mutex> lock(profiles.mutex);
+    profiles.pending[info] = std::move(profile);
+  }
+  stack.pop_back();
+}
+
+void tRegistrationProfiler::BeginRegistration(const void* info)
+{
+  tRegistrationProfile profile;
+  tProfiles& profiles = GetProfiles();
+  {
+    std::unique_lock<std::mutex> lock(profiles.mutex);
+    auto it = profiles.pending.find(info);
+    if (it != profiles.pending.end())
+    {
+      profile = std::move(it->second);
+      profiles.pending.erase(it);
+    }
+  }
+  GetThreadStack().push_back(std::move(profile));
+}
+
+void tRegistrationProfiler::EndRegistration(const std::string& type_name, const std::string& binary, int16_t uid)
+{
+  auto& stack = GetThreadStack();
+  assert(stack.size());
+  tRegistrationProfile& profile = stack.back();
+  profile.type_name = type_name;
+  profile.binary = binary;
+  profile.uid = uid;
+
+  tProfiles& profiles = GetProfiles();
+  {
+    std::unique_lock<std::mutex> lock(profiles.mutex);
+    profiles.completed.push_back(std::move(profile));
+  }
+  stack.pop_back();
+}
+
+tRegistrationProfiler::tPhaseScope::~tPhaseScope()
+{
+  auto& stack = GetThreadStack();
+  if (stack.size())
+  {
+    stack.back().durations[static_cast<size_t>(phase)] += std::chrono::steady_clock::now() - start;
+  }
+}
+
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+#endif
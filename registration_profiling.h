@@ -0,0 +1,205 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti/registration_profiling.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * Optional profiling of type registration.
+ *
+ * If RRLIB_RTTI_REGISTRATION_PROFILING_ENABLED is defined to 1 (when compiling
+ * rrlib_rtti and everything using it), the time spent in the different phases of
+ * registering each type is recorded. This helps finding out which binaries and
+ * types make static initialization (and thus startup) slow.
+ *
+ * Durations are inclusive: e.g. the Init() phase of a type contains the complete
+ * registration of its auto-registered list type (which has a record of its own).
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__rtti__registration_profiling_h__
+#define __rrlib__rtti__registration_profiling_h__
+
+#ifndef RRLIB_RTTI_REGISTRATION_PROFILING_ENABLED
+#define RRLIB_RTTI_REGISTRATION_PROFILING_ENABLED 0
+#endif
+
+#if RRLIB_RTTI_REGISTRATION_PROFILING_ENABLED
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*! Phases of type registration that are profiled */
+enum class tRegistrationPhase
+{
+  INFO_CONSTRUCTION,  //!< Construction of type info (includes name computation and binary detection)
+  NAME_COMPUTATION,   //!< Computation of type names from rtti names
+  BINARY_DETECTION,   //!< Detection of binary performing static initialization
+  INIT,               //!< tInfo::Init() (auto-registration of related types)
+  MUTEX_WAIT,         //!< Waiting for registry mutex
+  DIMENSION
+};
+
+/*!
+ * Profile of a single type's registration
+ */
+struct tRegistrationProfile
+{
+  /*! Name of type */
+  std::string type_name;
+
+  /*! Binary that registered type (see tType::GetBinary()) */
+  std::string binary;
+
+  /*! Uid of type */
+  int16_t uid;
+
+  /*! Time when registration started */
+  std::chrono::steady_clock::time_point start;
+
+  /*! Time spent in each phase (index is tRegistrationPhase) */
+  std::chrono::nanoseconds durations[static_cast<size_t>(tRegistrationPhase::DIMENSION)];
+
+  tRegistrationProfile();
+
+  /*!
+   * \param phase Phase
+   * \return Time spent in phase
+   */
+  std::chrono::nanoseconds GetDuration(tRegistrationPhase phase) const
+  {
+    return durations[static_cast<size_t>(phase)];
+  }
+};
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+/*!
+ * \return Profiles of all types registered so far (ordered by completion of registration)
+ */
+std::vector<tRegistrationProfile> GetRegistrationProfiles();
+
+/*!
+ * Prints profiles of all types registered so far - grouped by binary
+ *
+ * \param stream Stream to print to
+ */
+void PrintRegistrationProfiles(std::ostream& stream);
+
+/*!
+ * Prints profiles of all registered types to std::cerr when the process exits
+ * (may be called multiple times - profiles are printed once)
+ */
+void PrintRegistrationProfilesAtExit();
+
+namespace detail
+{
+
+/*!
+ * Hooks called during type registration.
+ * Records are kept on a thread-local stack while their type is constructed or registered.
+ * The type info's address identifies a record between construction and registration.
+ */
+class tRegistrationProfiler
+{
+public:
+
+  static void BeginInfoConstruction();
+  static void EndInfoConstruction(const void* info);
+  static void BeginRegistration(const void* info);
+  static void EndRegistration(const std::string& type_name, const std::string& binary, int16_t uid);
+
+  /*!
+   * Adds time of its lifetime to the specified phase of the record on top of the current thread's stack
+   */
+  class tPhaseScope
+  {
+  public:
+    tPhaseScope(tRegistrationPhase phase) : phase(phase), start(std::chrono::steady_clock::now())
+    {}
+
+    ~tPhaseScope();
+
+  private:
+    tRegistrationPhase phase;
+    std::chrono::steady_clock::time_point start;
+  };
+
+  /*! Function-local static objects placed before and after type info (see tDataType<T>::GetDataTypeInfo) */
+  struct tInfoConstructionBegin
+  {
+    tInfoConstructionBegin()
+    {
+      BeginInfoConstruction();
+    }
+  };
+  struct tInfoConstructionEnd
+  {
+    tInfoConstructionEnd(const void* info)
+    {
+      EndInfoConstruction(info);
+    }
+  };
+};
+
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+#define RRLIB_RTTI_PROFILE_REGISTRATION_PHASE(phase) rrlib::rtti::detail::tRegistrationProfiler::tPhaseScope rrlib_rtti_registration_phase_scope(rrlib::rtti::tRegistrationPhase::phase)
+
+#else
+
+#define RRLIB_RTTI_PROFILE_REGISTRATION_PHASE(phase)
+
+#endif
+
+#endif
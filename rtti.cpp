@@ -28,12 +28,17 @@
  */
 //----------------------------------------------------------------------
 #include "rrlib/rtti/rtti.h"
+#include "rrlib/rtti/registration_profiling.h"
 
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
 #if __linux__
+#include <dlfcn.h>
 #include <execinfo.h>
+#include <link.h>
+#include <mutex>
+#include <unordered_map>
 #endif
 
 //----------------------------------------------------------------------
@@ -69,16 +74,66 @@ namespace rtti
 // Implementation
 //----------------------------------------------------------------------
 
-static std::string GetSoFile(const std::string& backtrace_entry)
+#if RRLIB_RTTI_BINARY_DETECTION_ENABLED
+
+namespace
 {
-  return backtrace_entry.substr(0, backtrace_entry.find('('));
+
+/*! Address ranges of loaded segments of a binary */
+typedef std::vector<std::pair<uintptr_t, uintptr_t>> tSegments;
+
+/*! Data passed to FindSegments callback */
+struct tFindSegmentsData
+{
+  /*! Address to look for */
+  uintptr_t address;
+
+  /*! Segments of binary that contains address (result) */
+  tSegments segments;
+};
+
+/*!
+ * Callback for dl_iterate_phdr: looks for binary containing address
+ */
+int FindSegments(struct dl_phdr_info* info, size_t, void* data)
+{
+  tFindSegmentsData& find_data = *static_cast<tFindSegmentsData*>(data);
+  tSegments segments;
+  bool contains_address = false;
+  for (ElfW(Half) i = 0; i < info->dlpi_phnum; i++)
+  {
+    if (info->dlpi_phdr[i].p_type == PT_LOAD)
+    {
+      uintptr_t start = info->dlpi_addr + info->dlpi_phdr[i].p_vaddr;
+      uintptr_t end = start + info->dlpi_phdr[i].p_memsz;
+      segments.emplace_back(start, end);
+      contains_address |= (find_data.address >= start && find_data.address < end);
+    }
+  }
+  if (contains_address)
+  {
+    find_data.segments.swap(segments);
+    return 1;
+  }
+  return 0;
+}
+
 }
 
+#endif
+
 std::string GetBinaryCurrentlyPerformingStaticInitialization()
 {
 #if RRLIB_RTTI_BINARY_DETECTION_ENABLED
-  // system .so file that does dynamic loading
-  static std::string ld_so_file;
+  RRLIB_RTTI_PROFILE_REGISTRATION_PHASE(BINARY_DETECTION);
+
+  // Segments of system .so file that does dynamic loading
+  static tSegments ld_so_segments;
+  static bool ld_so_segments_initialized = false;
+
+  // Names of binaries (interned: key is base address of binary - which might be reused by another binary after dlclose())
+  static std::unordered_map<void*, std::string> binary_names;
+  static std::mutex mutex;
 
   // implementation uses backtrace to find this out
   void* array[255];
@@ -88,25 +143,44 @@ std::string GetBinaryCurrentlyPerformingStaticInitialization()
     RRLIB_LOG_PRINT_STATIC(ERROR, "Empty stack trace.");
     return "";
   }
-  char** symbols = backtrace_symbols(array, len);
-  if (ld_so_file.length() == 0)
+
+  std::unique_lock<std::mutex> lock(mutex);
+  if (!ld_so_segments_initialized)
   {
-    ld_so_file = GetSoFile(symbols[len - 1]);
-    RRLIB_LOG_PRINT_STATIC(DEBUG_VERBOSE_1, "System library for loading .so files: ", ld_so_file);
+    tFindSegmentsData find_data;
+    find_data.address = reinterpret_cast<uintptr_t>(array[len - 1]);
+    dl_iterate_phdr(&FindSegments, &find_data);
+    ld_so_segments.swap(find_data.segments);
+    ld_so_segments_initialized = true;
+    Dl_info info;
+    if (dladdr(array[len - 1], &info) && info.dli_fname)
+    {
+      RRLIB_LOG_PRINT_STATIC(DEBUG_VERBOSE_1, "System library for loading .so files: ", info.dli_fname);
+    }
   }
 
+  // Look for first frame in system library (comparing addresses only); the frame before belongs to the binary we are looking for
   for (int i = 1; i < len; i++)
   {
-    std::string so = GetSoFile(symbols[i]);
-    if (so.compare(ld_so_file) == 0)
+    uintptr_t address = reinterpret_cast<uintptr_t>(array[i]);
+    for (auto & segment : ld_so_segments)
     {
-      std::string result = GetSoFile(symbols[i - 1]);
-      free(symbols);
-      return result;
+      if (address >= segment.first && address < segment.second)
+      {
+        Dl_info info;
+        if (!(dladdr(array[i - 1], &info) && info.dli_fname))
+        {
+          return "";
+        }
+        std::string& binary_name = binary_names[info.dli_fbase];
+        if (binary_name != info.dli_fname)
+        {
+          binary_name = info.dli_fname;
+        }
+        return binary_name;
+      }
     }
   }
-
-  free(symbols);
 #endif
   return "";
 }
@@ -42,6 +42,7 @@
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "rrlib/rtti/tDataType.h"
+#include "rrlib/rtti/tTypeSet.h"
 
 //----------------------------------------------------------------------
 // Namespace declaration
@@ -0,0 +1,98 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti/tFingerprintTypeEncoder.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tFingerprintTypeEncoder
+ *
+ * \b tFingerprintTypeEncoder
+ *
+ * Type encoder that writes types to streams as their 64 bit fingerprints
+ * (see tType::GetFingerprint()).
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__rtti__tFingerprintTypeEncoder_h__
+#define __rrlib__rtti__tFingerprintTypeEncoder_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/serialization/serialization.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/rtti/tType.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Encodes types as fingerprints
+/*!
+ * Type encoder that writes types to streams as their 64 bit fingerprints
+ * (see tType::GetFingerprint()).
+ *
+ * Unlike tTypeEncoding::LOCAL_UIDS, this encoding can be decoded in other processes.
+ * Compared to tTypeEncoding::NAMES, it needs only 8 bytes per type - and decoding is a
+ * single hash table lookup.
+ *
+ * To use it, pass an instance to the constructor of the output and input streams
+ * (tType's stream operators then call it for tTypeEncoding::CUSTOM).
+ */
+class tFingerprintTypeEncoder : public serialization::tTypeEncoder
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  virtual tType ReadType(serialization::tInputStream& stream) override;
+
+  virtual void WriteType(serialization::tOutputStream& stream, tType type) override;
+
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,144 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti/tGenericArray.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/rtti/tGenericArray.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+tGenericArray::tGenericArray(const tType& type, size_t size) :
+  type(type),
+  size(size),
+  memory(NULL),
+  data(NULL)
+{
+  if (type == NULL || size == 0)
+  {
+    this->size = 0;
+    return;
+  }
+
+  // operator new only guarantees alignment for fundamental types - so memory is aligned manually
+  size_t alignment = std::max<size_t>(type.GetAlignment(), 1);
+  if (size > (SIZE_MAX - alignment) / std::max<size_t>(type.GetSize(), 1))
+  {
+    throw std::bad_alloc();
+  }
+  memory = operator new(size * type.GetSize() + alignment - 1);
+  uintptr_t address = reinterpret_cast<uintptr_t>(memory);
+  data = reinterpret_cast<void*>(address + (alignment - address % alignment) % alignment);
+  try
+  {
+    type.ConstructInstances(data, size);
+  }
+  catch (...)
+  {
+    operator delete(memory);
+    throw;
+  }
+}
+
+tGenericArray::tGenericArray(tGenericArray && other) :
+  type(other.type),
+  size(other.size),
+  memory(other.memory),
+  data(other.data)
+{
+  other.size = 0;
+  other.memory = NULL;
+  other.data = NULL;
+}
+
+tGenericArray& tGenericArray::operator=(tGenericArray && other)
+{
+  if (this != &other)
+  {
+    Clear();
+    std::swap(type, other.type);
+    std::swap(size, other.size);
+    std::swap(memory, other.memory);
+    std::swap(data, other.data);
+  }
+  return *this;
+}
+
+void tGenericArray::Clear()
+{
+  if (memory)
+  {
+    type.DestructInstances(data, size);
+    operator delete(memory);
+  }
+  size = 0;
+  memory = NULL;
+  data = NULL;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
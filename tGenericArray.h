@@ -0,0 +1,236 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti/tGenericArray.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tGenericArray
+ *
+ * \b tGenericArray
+ *
+ * Contiguous array of objects of a type that is only known at runtime.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__rtti__tGenericArray_h__
+#define __rrlib__rtti__tGenericArray_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tNoncopyable.h"
+#include <typeinfo>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/rtti/tType.h"
+#include "rrlib/rtti/type_traits.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Contiguous array of objects of runtime type
+/*!
+ * Array of objects of a type that is only known at runtime (see tType::CreateArrayGeneric).
+ * Elements are stored in a single, suitably aligned memory block - without generic object
+ * wrappers: element i is located at GetRawDataPointer() + i * GetStride().
+ * This allows cache-friendly iteration over many objects of the same type.
+ *
+ * All elements are constructed on creation - and destructed together when the array is cleared or destructed.
+ * Arrays can be moved - but not copied.
+ */
+class tGenericArray : private util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Creates empty array */
+  tGenericArray() :
+    type(),
+    size(0),
+    memory(NULL),
+    data(NULL)
+  {}
+
+  /*!
+   * Creates array and constructs all elements
+   *
+   * \param type Type of elements
+   * \param size Number of elements
+   * \throw std::bad_alloc if memory cannot be allocated (also if size of array would exceed addressable memory)
+   */
+  tGenericArray(const tType& type, size_t size);
+
+  tGenericArray(tGenericArray && other);
+
+  tGenericArray& operator=(tGenericArray && other);
+
+  /*! Destructs all elements and frees memory */
+  ~tGenericArray()
+  {
+    Clear();
+  }
+
+  /*!
+   * Destructs all elements and frees memory (array is empty afterwards)
+   */
+  void Clear();
+
+  /*!
+   * \return Whether array contains no elements
+   */
+  bool Empty() const
+  {
+    return size == 0;
+  }
+
+  /*!
+   * \param index Index of element
+   * \return Element (type T must match element type)
+   */
+  template <typename T>
+  const T& GetData(size_t index) const
+  {
+    assert(typeid(typename NormalizedType<T>::type).name() == type.GetRttiName());
+    return static_cast<const T*>(data)[index];
+  }
+
+  /*!
+   * \param index Index of element
+   * \return Element (type T must match element type)
+   */
+  template <typename T>
+  T& GetData(size_t index)
+  {
+    assert(typeid(typename NormalizedType<T>::type).name() == type.GetRttiName());
+    return static_cast<T*>(data)[index];
+  }
+
+  /*!
+   * \param index Index of element
+   * \return Raw pointer to element
+   */
+  const void* GetElementPointer(size_t index) const
+  {
+    assert(index < size);
+    return static_cast<const char*>(data) + index * type.GetSize();
+  }
+
+  /*!
+   * \param index Index of element
+   * \return Raw pointer to element
+   */
+  void* GetElementPointer(size_t index)
+  {
+    assert(index < size);
+    return static_cast<char*>(data) + index * type.GetSize();
+  }
+
+  /*!
+   * \return Raw pointer to first element (NULL if array is empty)
+   */
+  const void* GetRawDataPointer() const
+  {
+    return data;
+  }
+
+  /*!
+   * \return Raw pointer to first element (NULL if array is empty)
+   */
+  void* GetRawDataPointer()
+  {
+    return data;
+  }
+
+  /*!
+   * \return Distance between elements in bytes (equals size of element type)
+   */
+  size_t GetStride() const
+  {
+    return type.GetSize();
+  }
+
+  /*!
+   * \return Type of elements
+   */
+  tType GetType() const
+  {
+    return type;
+  }
+
+  /*!
+   * \return Number of elements
+   */
+  size_t Size() const
+  {
+    return size;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Type of elements */
+  tType type;
+
+  /*! Number of elements */
+  size_t size;
+
+  /*! Allocated memory block */
+  void* memory;
+
+  /*! First element (aligned address in memory block) */
+  void* data;
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
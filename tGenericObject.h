@@ -105,7 +105,7 @@ public:
   inline void DeepCopyFrom(const tGenericObject& source, tFactory* f = NULL)
   {
     assert((source.type == this->type) && "Types must match");
-    DeepCopyFrom(source.wrapped, f);
+    type.GetOperations().deep_copy(source.wrapped, wrapped, f);
   }
 
   /*!
@@ -121,7 +121,10 @@ public:
    *  3) T has trivial destructor and memcmp returns 0 (heuristic, however, I have never encountered a type where this is invalid)
    *  4) rrlib_serialization is available and both objects are serialized to the same binary data (usually they are equal then)
    */
-  virtual bool Equals(const tGenericObject& other) = 0;
+  inline bool Equals(const tGenericObject& other)
+  {
+    return wrapped == other.wrapped || (type == other.type && type.GetOperations().equals(wrapped, other.wrapped));
+  }
 
   /*!
    * \return Wrapped object (type T must match original type)
@@ -159,13 +162,19 @@ public:
     return wrapped;
   }
 
-  // Generic serialization
-  virtual void Deserialize(serialization::tInputStream& stream) = 0;
+  // Generic serialization (binary serialization is performed via the type's operations)
+  inline void Deserialize(serialization::tInputStream& stream)
+  {
+    type.GetOperations().deserialize(stream, wrapped);
+  }
   virtual void Deserialize(serialization::tStringInputStream& stream) = 0;
 #ifdef _LIB_RRLIB_XML_PRESENT_
   virtual void Deserialize(const xml::tNode& node) = 0;
 #endif
-  virtual void Serialize(serialization::tOutputStream& stream) const = 0;
+  inline void Serialize(serialization::tOutputStream& stream) const
+  {
+    type.GetOperations().serialize(stream, wrapped);
+  }
   virtual void Serialize(serialization::tStringOutputStream& stream) const = 0;
 #ifdef _LIB_RRLIB_XML_PRESENT_
   virtual void Serialize(xml::tNode& node) const = 0;
@@ -206,19 +215,6 @@ protected:
     this->type = dt;
   }
 
-//----------------------------------------------------------------------
-// Private fields and methods
-//----------------------------------------------------------------------
-private:
-
-  /*!
-   * Deep copy source object to this object
-   * (types MUST match)
-   *
-   * \param source Source object
-   */
-  virtual void DeepCopyFrom(const void* source, tFactory* f) = 0;
-
 };
 
 //----------------------------------------------------------------------
@@ -0,0 +1,151 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti/tGenericObjectArena.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/rtti/tGenericObjectArena.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <cstdint>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+tGenericObjectArena::tGenericObjectArena(size_t chunk_size) :
+  chunk_size(chunk_size),
+  chunks(),
+  current_chunk(0),
+  current_chunk_used(0),
+  previous_chunks_used(0),
+  objects_to_destruct()
+{}
+
+tGenericObjectArena::~tGenericObjectArena()
+{
+  Reset();
+  for (tChunk & chunk : chunks)
+  {
+    operator delete(chunk.memory);
+  }
+}
+
+void* tGenericObjectArena::Allocate(size_t size, size_t alignment)
+{
+  alignment = std::max<size_t>(alignment, 1);
+  while (current_chunk < chunks.size())
+  {
+    tChunk& chunk = chunks[current_chunk];
+    uintptr_t start = reinterpret_cast<uintptr_t>(chunk.memory) + current_chunk_used;
+    size_t padding = (alignment - start % alignment) % alignment;
+    if (current_chunk_used + padding + size <= chunk.size)
+    {
+      current_chunk_used += padding + size;
+      return reinterpret_cast<void*>(start + padding);
+    }
+    previous_chunks_used += current_chunk_used;
+    current_chunk++;
+    current_chunk_used = 0;
+  }
+
+  // Allocate new chunk (current_chunk == chunks.size())
+  tChunk chunk;
+  chunk.size = std::max(chunk_size, size + alignment);
+  chunk.memory = static_cast<char*>(operator new(chunk.size));
+  chunks.push_back(chunk);
+  return Allocate(size, alignment);
+}
+
+tGenericObject* tGenericObjectArena::CreateInstance(const tType& type)
+{
+  if (type == NULL)
+  {
+    return NULL;
+  }
+  void* memory = Allocate(type.GetSize(true), type.GetAlignment(true));
+  tGenericObject* object = type.CreateInstanceGeneric(memory, true);
+  if (!(type.GetTypeTraits() & trait_flags::cHAS_TRIVIAL_DESTRUCTOR))
+  {
+    objects_to_destruct.push_back(object);
+  }
+  return object;
+}
+
+size_t tGenericObjectArena::GetAllocatedSize() const
+{
+  return previous_chunks_used + current_chunk_used;
+}
+
+void tGenericObjectArena::Reset()
+{
+  for (auto it = objects_to_destruct.rbegin(); it != objects_to_destruct.rend(); ++it)
+  {
+    tType::DestroyInstanceGeneric(*it);
+  }
+  objects_to_destruct.clear();
+  current_chunk = 0;
+  current_chunk_used = 0;
+  previous_chunks_used = 0;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
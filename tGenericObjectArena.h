@@ -0,0 +1,157 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti/tGenericObjectArena.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tGenericObjectArena
+ *
+ * \b tGenericObjectArena
+ *
+ * Arena (monotonic allocator) for generic objects of arbitrary types.
+ * Memory for generic objects is bump-allocated from large chunks.
+ * All objects are destructed together when the arena is reset.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__rtti__tGenericObjectArena_h__
+#define __rrlib__rtti__tGenericObjectArena_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/rtti/tGenericObject.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Arena for generic objects
+/*!
+ * Arena (monotonic allocator) for generic objects of arbitrary types
+ * (e.g. for objects that are needed during a single processing cycle).
+ *
+ * Memory for generic objects is bump-allocated (with correct alignment) from large chunks.
+ * Objects cannot be released individually: Reset() destructs all objects at once - only calling
+ * destructors of types without trivial destructor - and makes the chunks available again.
+ * Chunks are kept until the arena is destructed - so a reused arena does not allocate memory anymore.
+ *
+ * Arenas are not thread-safe.
+ */
+class tGenericObjectArena : private util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * \param chunk_size Size of memory chunks that are allocated (larger objects get chunks of their own)
+   */
+  explicit tGenericObjectArena(size_t chunk_size = 65536);
+
+  /*! Destructs all objects and frees memory */
+  ~tGenericObjectArena();
+
+  /*!
+   * Creates generic object in arena (equivalent to type.CreateInstanceGeneric(arena))
+   *
+   * \param type Type of object
+   * \return Generic object (must not be deleted; NULL for NULL type)
+   */
+  tGenericObject* CreateInstance(const tType& type);
+
+  /*!
+   * \return Number of bytes allocated for objects since last reset (including padding for alignment)
+   */
+  size_t GetAllocatedSize() const;
+
+  /*!
+   * Destructs all objects created since the last reset (in reverse order of creation) and makes memory available for new objects
+   */
+  void Reset();
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Memory chunk */
+  struct tChunk
+  {
+    char* memory;
+    size_t size;
+  };
+
+  /*! Size of chunks that are allocated */
+  const size_t chunk_size;
+
+  /*! Allocated chunks */
+  std::vector<tChunk> chunks;
+
+  /*! Index of chunk that objects are currently allocated from */
+  size_t current_chunk;
+
+  /*! Number of bytes used in current chunk */
+  size_t current_chunk_used;
+
+  /*! Number of bytes used in previous chunks */
+  size_t previous_chunks_used;
+
+  /*! Objects whose destructor needs to be called on reset */
+  std::vector<tGenericObject*> objects_to_destruct;
+
+  /*!
+   * \param size Size of memory block
+   * \param alignment Alignment of memory block
+   * \return Memory block
+   */
+  void* Allocate(size_t size, size_t alignment);
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
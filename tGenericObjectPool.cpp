@@ -0,0 +1,278 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti/tGenericObjectPool.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/rtti/tGenericObjectPool.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <stdexcept>
+#include "rrlib/logging/messages.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/rtti/tTypeSideTable.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+/*!
+ * Free blocks of one pool cached by one thread.
+ * On thread exit, cached blocks are returned to the pool.
+ */
+struct tGenericObjectPool::tThreadCache
+{
+  /*! Pool that blocks belong to (NULL if cache has not been used yet) */
+  tGenericObjectPool* pool = NULL;
+
+  /*! Cached free blocks */
+  std::vector<void*> blocks;
+
+  tThreadCache() {}
+
+  tThreadCache(tThreadCache && other) noexcept :
+    pool(other.pool),
+    blocks(std::move(other.blocks))
+  {
+    other.pool = NULL;
+  }
+
+  ~tThreadCache()
+  {
+    if (pool)
+    {
+      pool->ReturnBlocks(blocks, 0);
+    }
+  }
+};
+
+/*! Pools of all types - and mutex for creating them. Never deleted, as pool objects are never deleted. */
+struct tGenericObjectPool::tPools
+{
+  /*! Side table with pools - releases blocks of pools whose types are unregistered */
+  class tPoolTable : public tTypeSideTable<tGenericObjectPool*>
+  {
+    virtual void OnEntryReset(tGenericObjectPool* const& pool) override
+    {
+      if (pool)
+      {
+        pool->ReleaseBlocks();
+        tPools& instance = GetInstance();
+        std::unique_lock<std::mutex> lock(instance.mutex);
+        instance.released_pools.push_back(pool);
+      }
+    }
+  };
+
+  std::mutex mutex;
+  tPoolTable pools;
+
+  /*! Pools of unregistered types (kept, as thread caches may still refer to them) */
+  std::vector<tGenericObjectPool*> released_pools;
+
+  static tPools& GetInstance()
+  {
+    static tPools* pools = new tPools();
+    return *pools;
+  }
+};
+
+tGenericObjectPool::tGenericObjectPool(const tType& type) :
+  type(type),
+  block_size(type.GetSize(true)),
+  mutex(),
+  free_blocks(),
+  released(false)
+{}
+
+tGenericObject* tGenericObjectPool::Acquire()
+{
+  tThreadCache& cache = GetThreadCache();
+  if (cache.blocks.empty())
+  {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      size_t count = std::min<size_t>(free_blocks.size(), cTHREAD_CACHE_SIZE / 2);
+      cache.blocks.insert(cache.blocks.end(), free_blocks.end() - count, free_blocks.end());
+      free_blocks.resize(free_blocks.size() - count);
+    }
+    if (cache.blocks.empty())
+    {
+      cache.blocks.push_back(operator new(block_size));
+    }
+  }
+
+  void* block = cache.blocks.back();
+  cache.blocks.pop_back();
+  try
+  {
+    return type.CreateInstanceGeneric(block, true);
+  }
+  catch (...)
+  {
+    cache.blocks.push_back(block);
+    throw;
+  }
+}
+
+tGenericObjectPool& tGenericObjectPool::GetInstance(const tType& type)
+{
+  if (type == NULL)
+  {
+    RRLIB_LOG_PRINT_STATIC(ERROR, "There is no pool for the NULL type.");
+    throw std::invalid_argument("There is no pool for the NULL type");
+  }
+  tPools& pools = tPools::GetInstance();
+  tGenericObjectPool* pool = pools.pools[type];
+  if (!pool)
+  {
+    std::unique_lock<std::mutex> lock(pools.mutex);
+    pool = pools.pools[type];
+    if (!pool)
+    {
+      pool = new tGenericObjectPool(type);
+      pools.pools.Set(type, pool);
+    }
+  }
+  return *pool;
+}
+
+tGenericObjectPool::tThreadCache& tGenericObjectPool::GetThreadCache()
+{
+  static thread_local std::vector<tThreadCache> caches; // index is uid
+  size_t uid = static_cast<size_t>(type.GetUid());
+  if (caches.size() <= uid)
+  {
+    caches.resize(uid + 1);
+  }
+  tThreadCache& cache = caches[uid];
+  if (cache.pool != this)
+  {
+    if (cache.pool) // uid has been reused for another type
+    {
+      cache.pool->ReturnBlocks(cache.blocks, 0);
+    }
+    cache.pool = this;
+  }
+  return cache;
+}
+
+void tGenericObjectPool::Release(tGenericObject* object)
+{
+  if (!object)
+  {
+    return;
+  }
+  assert(object->GetType() == type && "Object does not belong to this pool");
+  void* block = dynamic_cast<void*>(object);
+  tType::DestroyInstanceGeneric(object);
+
+  tThreadCache& cache = GetThreadCache();
+  cache.blocks.push_back(block);
+  if (cache.blocks.size() > cTHREAD_CACHE_SIZE)
+  {
+    ReturnBlocks(cache.blocks, cTHREAD_CACHE_SIZE / 2);
+  }
+}
+
+void tGenericObjectPool::Reserve(size_t block_count)
+{
+  std::unique_lock<std::mutex> lock(mutex);
+  free_blocks.reserve(block_count);
+  while (free_blocks.size() < block_count)
+  {
+    free_blocks.push_back(operator new(block_size));
+  }
+}
+
+void tGenericObjectPool::ReleaseBlocks()
+{
+  std::unique_lock<std::mutex> lock(mutex);
+  released = true;
+  for (void* block : free_blocks)
+  {
+    operator delete(block);
+  }
+  free_blocks.clear();
+  free_blocks.shrink_to_fit();
+}
+
+void tGenericObjectPool::ReturnBlocks(std::vector<void*>& blocks, size_t keep)
+{
+  if (blocks.size() > keep)
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (released)
+    {
+      for (auto it = blocks.begin() + keep; it != blocks.end(); ++it)
+      {
+        operator delete(*it);
+      }
+    }
+    else
+    {
+      free_blocks.insert(free_blocks.end(), blocks.begin() + keep, blocks.end());
+    }
+  }
+  blocks.resize(std::min(keep, blocks.size()));
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,182 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti/tGenericObjectPool.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tGenericObjectPool
+ *
+ * \b tGenericObjectPool
+ *
+ * Pool of memory blocks for generic objects of one type.
+ * Generic objects are created in blocks from the pool - and blocks are returned
+ * to the pool when objects are released. Each thread caches some free blocks.
+ * Once the pool has been filled (see Reserve()), no memory is allocated
+ * from the global allocator anymore.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__rtti__tGenericObjectPool_h__
+#define __rrlib__rtti__tGenericObjectPool_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <mutex>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/rtti/tGenericObject.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Pool for generic objects of one type
+/*!
+ * Pool of memory blocks (of size tType::GetSize(true)) for generic objects of one type.
+ * Generic objects are created in blocks from the pool (see Acquire()) - and blocks are returned
+ * to the pool when objects are released (see Release()).
+ *
+ * Each thread caches up to cTHREAD_CACHE_SIZE free blocks of each pool - so that acquiring and
+ * releasing objects usually requires no locking. Blocks are exchanged with the pool's shared
+ * list of free blocks in batches.
+ * Once the pool has been filled (see Reserve()), no memory is allocated from the global allocator anymore.
+ *
+ * There is one pool per type. When the type is unregistered (see tType::UnregisterBinary()), the pool deallocates its
+ * free blocks - and blocks that threads return later. The pool object itself is kept, as thread caches may still refer to it.
+ */
+class tGenericObjectPool : private util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Maximum number of free blocks that each thread caches per pool */
+  enum { cTHREAD_CACHE_SIZE = 64 };
+
+  /*!
+   * Creates generic object in block from pool (allocates a new block if no free blocks are left)
+   *
+   * \return Generic object (must be released with Release() - instead of being deleted)
+   */
+  tGenericObject* Acquire();
+
+  /*!
+   * \param type Type
+   * \return Pool for generic objects of specified type (created on first call)
+   * \throw std::invalid_argument if type is the NULL type
+   */
+  static tGenericObjectPool& GetInstance(const tType& type);
+
+  /*!
+   * \return Type of objects in this pool
+   */
+  tType GetType() const
+  {
+    return type;
+  }
+
+  /*!
+   * Destructs generic object and returns its memory block to the pool
+   *
+   * \param object Object that was created with Acquire() of this pool
+   */
+  void Release(tGenericObject* object);
+
+  /*!
+   * Allocates free blocks so that at least the specified number of free blocks are available in the pool's shared list
+   * (e.g. to pre-warm pool at startup)
+   *
+   * \param block_count Number of blocks
+   */
+  void Reserve(size_t block_count);
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  struct tThreadCache;
+  struct tPools;
+
+  /*! Type of objects in this pool */
+  const tType type;
+
+  /*! Size of memory blocks */
+  const size_t block_size;
+
+  /*! Mutex for 'free_blocks' */
+  std::mutex mutex;
+
+  /*! Shared list of free blocks */
+  std::vector<void*> free_blocks;
+
+  /*! Whether type of pool has been unregistered (returned blocks are deallocated) */
+  bool released;
+
+  tGenericObjectPool(const tType& type);
+
+  /*!
+   * Deallocates free blocks after type of pool has been unregistered
+   */
+  void ReleaseBlocks();
+
+  /*!
+   * \return Current thread's cache of free blocks of this pool
+   */
+  tThreadCache& GetThreadCache();
+
+  /*!
+   * Moves free blocks from thread cache to shared list
+   *
+   * \param blocks Blocks of thread cache
+   * \param keep Number of blocks to keep in thread cache
+   */
+  void ReturnBlocks(std::vector<void*>& blocks, size_t keep);
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,211 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti/tGenericValue.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/rtti/tGenericValue.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+tGenericValue::tGenericValue(const tType& type) :
+  type(type)
+{
+  if (type != NULL)
+  {
+    void* memory = Allocate();
+    try
+    {
+      type.ConstructInstances(memory, 1);
+    }
+    catch (...)
+    {
+      if (!IsInline(type))
+      {
+        operator delete(storage.heap_block);
+      }
+      this->type = tType();
+      throw;
+    }
+  }
+}
+
+tGenericValue::tGenericValue(const tGenericValue& other) :
+  tGenericValue(other.type)
+{
+  if (type != NULL)
+  {
+    type.DeepCopy(other.GetRawDataPointer(), GetRawDataPointer());
+  }
+}
+
+tGenericValue::tGenericValue(tGenericValue && other) noexcept :
+  type()
+{
+  MoveFrom(other);
+}
+
+tGenericValue& tGenericValue::operator=(const tGenericValue& other)
+{
+  if (this != &other)
+  {
+    if (type != other.type)
+    {
+      tGenericValue copy(other);
+      Clear();
+      MoveFrom(copy);
+    }
+    else if (type != NULL)
+    {
+      type.DeepCopy(other.GetRawDataPointer(), GetRawDataPointer());
+    }
+  }
+  return *this;
+}
+
+tGenericValue& tGenericValue::operator=(tGenericValue && other) noexcept
+{
+  if (this != &other)
+  {
+    Clear();
+    MoveFrom(other);
+  }
+  return *this;
+}
+
+void* tGenericValue::Allocate()
+{
+  if (IsInline(type))
+  {
+    return &storage;
+  }
+  storage.heap_block = operator new(type.GetSize() + std::max<size_t>(type.GetAlignment(), 1) - 1);
+  return GetRawDataPointer();
+}
+
+void tGenericValue::Clear()
+{
+  if (type != NULL)
+  {
+    type.DestructInstances(GetRawDataPointer(), 1);
+    if (!IsInline(type))
+    {
+      operator delete(storage.heap_block);
+    }
+    type = tType();
+  }
+}
+
+void tGenericValue::MoveFrom(tGenericValue& other) noexcept
+{
+  assert(type == NULL);
+  if (other.type == NULL)
+  {
+    return;
+  }
+  type = other.type;
+  if (IsInline(type))
+  {
+    type.MoveConstruct(other.GetRawDataPointer(), &storage); // does not throw (see IsInline())
+    type.DestructInstances(other.GetRawDataPointer(), 1);
+  }
+  else
+  {
+    // Take over heap block
+    storage.heap_block = other.storage.heap_block;
+  }
+  other.type = tType();
+}
+
+bool tGenericValue::Equals(const tGenericValue& other) const
+{
+  if (type != other.type)
+  {
+    return false;
+  }
+  return type == NULL || GetRawDataPointer() == other.GetRawDataPointer() || type.Equals(GetRawDataPointer(), other.GetRawDataPointer());
+}
+
+serialization::tOutputStream& operator << (serialization::tOutputStream& stream, const tGenericValue& value)
+{
+  stream << value.GetType();
+  value.GetType().Serialize(stream, value.GetRawDataPointer());
+  return stream;
+}
+
+serialization::tInputStream& operator >> (serialization::tInputStream& stream, tGenericValue& value)
+{
+  tType type;
+  stream >> type;
+  if (type != value.GetType())
+  {
+    value = tGenericValue(type);
+  }
+  type.Deserialize(stream, value.GetRawDataPointer());
+  return stream;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,258 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti/tGenericValue.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tGenericValue
+ *
+ * \b tGenericValue
+ *
+ * Value of a type that is only known at runtime - with value semantics.
+ * Small values are stored inline (without heap allocation).
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__rtti__tGenericValue_h__
+#define __rrlib__rtti__tGenericValue_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <typeinfo>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/rtti/tType.h"
+#include "rrlib/rtti/type_traits.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Generic value
+/*!
+ * Value of a type that is only known at runtime.
+ * In contrast to tGenericObject, tGenericValue has value semantics (it can be copied, moved and compared)
+ * and has no virtual methods: it consists of its type and an inline buffer of cINLINE_CAPACITY bytes.
+ * Values whose type fits into this buffer (size and alignment) - and can be moved without throwing - are stored inline.
+ * Only other values are allocated on the heap.
+ * Therefore, moving a tGenericValue never throws. The moved-from value is empty afterwards.
+ * This makes tGenericValue suitable for storing many (small) values - e.g. parameters.
+ *
+ * All operations are performed via the type's generic operations (see tType).
+ */
+class tGenericValue
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  enum
+  {
+    cINLINE_CAPACITY = 32,  //!< Size of inline buffer in bytes
+    cINLINE_ALIGNMENT = 8   //!< Alignment of inline buffer
+  };
+
+  /*! Creates empty value (with NULL type) */
+  tGenericValue() :
+    type()
+  {}
+
+  /*!
+   * Creates (default-constructed) value of specified type
+   *
+   * \param type Type of value
+   */
+  explicit tGenericValue(const tType& type);
+
+  tGenericValue(const tGenericValue& other);
+
+  tGenericValue(tGenericValue && other) noexcept;
+
+  ~tGenericValue()
+  {
+    Clear();
+  }
+
+  tGenericValue& operator=(const tGenericValue& other);
+
+  tGenericValue& operator=(tGenericValue && other) noexcept;
+
+  /*!
+   * Destructs value (value is empty afterwards)
+   */
+  void Clear();
+
+  /*!
+   * \param other Other value
+   * \return Whether values have the same type and are equal (two empty values are equal)
+   */
+  bool Equals(const tGenericValue& other) const;
+
+  /*!
+   * \return Value (type T must match type of value)
+   */
+  template <typename T>
+  const T& GetData() const
+  {
+    assert(typeid(typename NormalizedType<T>::type).name() == type.GetRttiName());
+    return *static_cast<const T*>(GetRawDataPointer());
+  }
+
+  /*!
+   * \return Value (type T must match type of value)
+   */
+  template <typename T>
+  T& GetData()
+  {
+    assert(typeid(typename NormalizedType<T>::type).name() == type.GetRttiName());
+    return *static_cast<T*>(GetRawDataPointer());
+  }
+
+  /*!
+   * \return Raw pointer to value (NULL if value is empty)
+   */
+  const void* GetRawDataPointer() const
+  {
+    return type == NULL ? NULL : (IsInline(type) ? static_cast<const void*>(&storage) : GetHeapData());
+  }
+
+  /*!
+   * \return Raw pointer to value (NULL if value is empty)
+   */
+  void* GetRawDataPointer()
+  {
+    return const_cast<void*>(static_cast<const tGenericValue*>(this)->GetRawDataPointer());
+  }
+
+  /*!
+   * \return Type of value (NULL if value is empty)
+   */
+  tType GetType() const
+  {
+    return type;
+  }
+
+  /*!
+   * \return Whether value is stored in inline buffer
+   */
+  bool IsStoredInline() const
+  {
+    return type != NULL && IsInline(type);
+  }
+
+  /*!
+   * \param type Type
+   * \return Whether values of specified type are stored in inline buffer
+   */
+  static bool IsInline(const tType& type)
+  {
+    return type.GetSize() <= cINLINE_CAPACITY && type.GetAlignment() <= cINLINE_ALIGNMENT && (type.GetTypeTraits() & trait_flags::cIS_NOTHROW_MOVE_CONSTRUCTIBLE);
+  }
+
+  bool operator==(const tGenericValue& other) const
+  {
+    return Equals(other);
+  }
+
+  bool operator!=(const tGenericValue& other) const
+  {
+    return !Equals(other);
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Type of value */
+  tType type;
+
+  /*! Inline buffer - or pointer to heap block (for large values) */
+  union
+  {
+    std::aligned_storage<cINLINE_CAPACITY, cINLINE_ALIGNMENT>::type inline_buffer;
+    void* heap_block;
+  } storage;
+
+  /*!
+   * Allocates memory for value of current type (if it is not stored inline)
+   *
+   * \return Pointer to (uninitialized) memory for value
+   */
+  void* Allocate();
+
+  /*!
+   * \return Pointer to value stored on heap (aligned address in heap block)
+   */
+  const void* GetHeapData() const
+  {
+    size_t alignment = std::max<size_t>(type.GetAlignment(), 1);
+    uintptr_t address = reinterpret_cast<uintptr_t>(storage.heap_block);
+    return reinterpret_cast<const void*>(address + (alignment - address % alignment) % alignment);
+  }
+
+  /*!
+   * Moves value from other value to this (empty) value.
+   * Other value is empty afterwards.
+   *
+   * \param other Other value
+   */
+  void MoveFrom(tGenericValue& other) noexcept;
+};
+
+serialization::tOutputStream& operator << (serialization::tOutputStream& stream, const tGenericValue& value);
+serialization::tInputStream& operator >> (serialization::tInputStream& stream, tGenericValue& value);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,125 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti/tInternedName.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/rtti/tInternedName.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <mutex>
+#include <unordered_map>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+/*!
+ * Interned names (key) with their hashes (value).
+ * Elements of unordered_map are not moved on rehashing - so they can be referenced by tInternedName objects.
+ * As names are interned during static initialization (and may be used during static deinitialization),
+ * the pool is never deleted.
+ */
+struct tInternedNamePool
+{
+  std::mutex mutex;
+  std::unordered_map<std::string, size_t> entries;
+};
+
+static tInternedNamePool& GetPool()
+{
+  static tInternedNamePool* pool = new tInternedNamePool();
+  return *pool;
+}
+
+tInternedName::tInternedName(const std::string& name) :
+  entry(GetEntry(name, true))
+{}
+
+tInternedName tInternedName::Find(const std::string& name)
+{
+  const tEntry* entry = GetEntry(name, false);
+  return tInternedName(entry ? entry : GetEmptyEntry());
+}
+
+const tInternedName::tEntry* tInternedName::GetEntry(const std::string& name, bool insert)
+{
+  tInternedNamePool& pool = GetPool();
+  std::unique_lock<std::mutex> lock(pool.mutex);
+  auto it = pool.entries.find(name);
+  if (it == pool.entries.end())
+  {
+    if (!insert)
+    {
+      return nullptr;
+    }
+    it = pool.entries.emplace(name, std::hash<std::string>()(name)).first;
+  }
+  return &(*it);
+}
+
+const tInternedName::tEntry* tInternedName::GetEmptyEntry()
+{
+  static const tEntry* empty = GetEntry(std::string(), true);
+  return empty;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
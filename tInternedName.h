@@ -0,0 +1,180 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti/tInternedName.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tInternedName
+ *
+ * \b tInternedName
+ *
+ * Handle to an interned (type) name.
+ * Each distinct string is stored only once - together with its hash.
+ * Therefore, interned names can be compared by pointer and hashed without
+ * looking at the characters - which makes them efficient keys for maps.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__rtti__tInternedName_h__
+#define __rrlib__rtti__tInternedName_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <functional>
+#include <string>
+#include <utility>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Interned name
+/*!
+ * Handle to an interned (type) name.
+ * Each distinct string is stored only once - together with its hash.
+ * Therefore, interned names can be compared by pointer and hashed without
+ * looking at the characters - which makes them efficient keys for maps.
+ *
+ * Interned strings are never deallocated.
+ * tInternedName is passed by value.
+ */
+class tInternedName
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Creates handle to empty string */
+  tInternedName() : entry(GetEmptyEntry())
+  {}
+
+  /*!
+   * Interns name (if it has not been interned before)
+   *
+   * \param name Name
+   */
+  explicit tInternedName(const std::string& name);
+
+  /*!
+   * \param name Name
+   * \return Interned name - or handle to empty string if name has not been interned yet
+   */
+  static tInternedName Find(const std::string& name);
+
+  /*!
+   * \return Hash of name (as calculated by std::hash<std::string>)
+   */
+  size_t GetHash() const
+  {
+    return entry->second;
+  }
+
+  /*!
+   * \return Name as string (reference remains valid for the lifetime of the process)
+   */
+  const std::string& GetString() const
+  {
+    return entry->first;
+  }
+
+  bool operator==(const tInternedName& other) const
+  {
+    return entry == other.entry;
+  }
+
+  bool operator!=(const tInternedName& other) const
+  {
+    return entry != other.entry;
+  }
+
+  /*! Order is arbitrary - but consistent during the lifetime of the process */
+  bool operator<(const tInternedName& other) const
+  {
+    return entry < other.entry;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Interned string with its hash (element of pool) */
+  typedef std::pair<const std::string, size_t> tEntry;
+
+  /*! Interned string */
+  const tEntry* entry;
+
+  tInternedName(const tEntry* entry) : entry(entry)
+  {}
+
+  /*!
+   * \param name Name
+   * \param insert Whether to intern name if it has not been interned yet
+   * \return Entry for name in pool (nullptr if there is none and 'insert' is false)
+   */
+  static const tEntry* GetEntry(const std::string& name, bool insert);
+
+  static const tEntry* GetEmptyEntry();
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+namespace std
+{
+
+template <>
+struct hash<rrlib::rtti::tInternedName>
+{
+  size_t operator()(const rrlib::rtti::tInternedName& name) const
+  {
+    return name.GetHash();
+  }
+};
+
+}
+
+
+#endif
@@ -0,0 +1,143 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti/tSpan.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tSpan
+ *
+ * \b tSpan
+ *
+ * Read-only view on a contiguous array.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__rtti__tSpan_h__
+#define __rrlib__rtti__tSpan_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cassert>
+#include <cstddef>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Read-only array view
+/*!
+ * Read-only view on a contiguous array (that is owned by somebody else).
+ * tSpan is passed by value.
+ *
+ * \tparam T Element type
+ */
+template <typename T>
+class tSpan
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef T value_type;
+  typedef const T* const_iterator;
+
+  tSpan() : elements(nullptr), element_count(0)
+  {}
+
+  /*!
+   * \param elements Pointer to first element
+   * \param element_count Number of elements
+   */
+  tSpan(const T* elements, size_t element_count) : elements(elements), element_count(element_count)
+  {}
+
+  const T* begin() const
+  {
+    return elements;
+  }
+
+  const T* data() const
+  {
+    return elements;
+  }
+
+  bool empty() const
+  {
+    return element_count == 0;
+  }
+
+  const T* end() const
+  {
+    return elements + element_count;
+  }
+
+  size_t size() const
+  {
+    return element_count;
+  }
+
+  const T& operator[](size_t index) const
+  {
+    assert(index < element_count);
+    return elements[index];
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Pointer to first element */
+  const T* elements;
+
+  /*! Number of elements */
+  size_t element_count;
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -32,9 +32,16 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <iterator>
 #include <mutex>
 #include <set>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include "rrlib/logging/messages.h"
 #include "rrlib/util/demangle.h"
 
@@ -42,7 +49,15 @@
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "rrlib/rtti/rtti.h"
+#include "rrlib/rtti/registration_profiling.h"
+#include "rrlib/rtti/tGenericArray.h"
+#include "rrlib/rtti/tGenericObjectArena.h"
 #include "rrlib/rtti/tTypeAnnotation.h"
+#include "rrlib/rtti/tTypeSideTable.h"
+#include "rrlib/rtti/tTypeSet.h"
+#include "rrlib/rtti/detail/tMultiPatternReplacer.h"
+#include "rrlib/rtti/detail/tSegmentedArray.h"
+#include "rrlib/rtti/detail/type_names.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -69,8 +84,19 @@ namespace rtti
 // Const values
 //----------------------------------------------------------------------
 
-/*! we need to avoid reallocation in order to make vector thread safe. Therefore it is created with this capacity. */
-const size_t cMAX_TYPES = 1000;
+const size_t cMAX_TYPES = tType::cMAX_TYPES;
+
+/*! Number of bits in bit vector of type traits */
+const size_t cTRAIT_COUNT = sizeof(int) * 8;
+
+/*! Number of words in bit vectors with one bit per uid */
+const size_t cUID_BIT_VECTOR_WORDS = cMAX_TYPES / 64;
+
+/*! Number of types per segment of type registry */
+const size_t cTYPE_REGISTRY_SEGMENT_SIZE = 256;
+
+/*! Names of std containers in rrlib::rtti type names */
+const detail::tContainerNameMapping cCONTAINER_NAMES[] = { {"std::vector", "List"}, {"std::set", "Set"}, {"std::map", "Map"}, {"std::tuple", "Tuple"} };
 
 //----------------------------------------------------------------------
 // Implementation
@@ -83,21 +109,199 @@ static std::recursive_mutex& GetMutex()
   return mutex;
 }
 
-static std::vector<tType>& GetTypeVector()
+/*!
+ * Serializes unregistrations (must be locked before GetMutex()).
+ * As UnregisterBinary() waits for guards without holding GetMutex(), this mutex ensures that only one thread does so.
+ */
+static std::mutex& GetUnregistrationMutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+/*!
+ * Registry with all types (index is uid).
+ * Types are added and removed while holding GetMutex(). Reading requires no locking.
+ * Slots are atomic, as they are cleared when types are unregistered (and possibly reused later).
+ */
+struct tTypeRegistry
+{
+  /*! Registered types (NULL types in slots of unregistered types) */
+  detail::tSegmentedArray<std::atomic<tType>, cTYPE_REGISTRY_SEGMENT_SIZE, cMAX_TYPES> types;
+
+  /*! Number of used uids (stored after type has been added to 'types') */
+  std::atomic<size_t> size;
+
+  /*! Uids of unregistered types that can be reused (lowest uid at the back) */
+  std::vector<int16_t> free_uids;
+
+  tTypeRegistry() : types(), size(0)
+  {}
+};
+
+/*!
+ * Helper method that safely provides static data type registry
+ */
+static tTypeRegistry& GetTypes()
+{
+  static tTypeRegistry registry;
+  return registry;
+}
+
+/*!
+ * Dense tables with information on all types (index is uid; see tType::GetClassificationTable()).
+ * Entries are written while holding GetMutex().
+ * Plain entries of a uid are only written before the type is published in tTypeRegistry - and after the grace period of UnregisterBinary().
+ * Entries that change while a type is registered are atomic.
+ * Apart from name (tInternedName's constructor initializes all entries), arrays with static storage duration are only backed by memory when they are touched.
+ */
+struct tTypeTables
+{
+  size_t size[cMAX_TYPES];
+  size_t generic_object_size[cMAX_TYPES];
+  int type_traits[cMAX_TYPES];
+  tType::tClassification classification[cMAX_TYPES];
+  tInternedName name[cMAX_TYPES];
+
+  /*! Uids of related types (atomic, as they change when related types are registered or unregistered) */
+  std::atomic<int16_t> element_type_uid[cMAX_TYPES];
+  std::atomic<int16_t> list_type_uid[cMAX_TYPES];
+
+  /*! Fingerprints of types (see SetFingerprint(); atomic, as they change when types are renamed) */
+  std::atomic<uint64_t> fingerprint[cMAX_TYPES];
+};
+
+static tTypeTables& GetTypeTables()
+{
+  static tTypeTables tables;
+  return tables;
+}
+
+/*!
+ * Bit vectors with one bit per uid for querying types by traits (see tType::GetTypesWithAllTraits()).
+ * Bits are modified while holding GetMutex(). They are atomic so that queries require no locking.
+ */
+struct tTraitBitVectors
+{
+  /*! Bits of registered types */
+  std::atomic<uint64_t> registered[cUID_BIT_VECTOR_WORDS];
+
+  /*! Bits of types with each trait (first index is bit index of trait) */
+  std::atomic<uint64_t> traits[cTRAIT_COUNT][cUID_BIT_VECTOR_WORDS];
+};
+
+static tTraitBitVectors& GetTraitBitVectors()
+{
+  static tTraitBitVectors bit_vectors; // zero-initialized
+  return bit_vectors;
+}
+
+/*!
+ * Clears bits of types that are currently being registered (their bits may be set before GetTypeCount() is increased)
+ *
+ * \param words Bit vector with one bit per uid
+ * \param type_count Result of GetTypeCount() that bit vector was created for
+ */
+static void MaskUnusedUids(std::vector<uint64_t>& words, size_t type_count)
+{
+  if (type_count % 64)
+  {
+    words.back() &= (static_cast<uint64_t>(1) << (type_count % 64)) - 1;
+  }
+}
+
+/*!
+ * Removes type with specified uid from trait bit vectors
+ * (GetMutex() must be locked)
+ *
+ * \param uid Uid of type
+ */
+static void ClearTraitBits(size_t uid)
+{
+  tTraitBitVectors& bit_vectors = GetTraitBitVectors();
+  uint64_t mask = ~(static_cast<uint64_t>(1) << (uid % 64));
+  bit_vectors.registered[uid / 64].fetch_and(mask);
+  for (size_t i = 0; i < cTRAIT_COUNT; i++)
+  {
+    bit_vectors.traits[i][uid / 64].fetch_and(mask);
+  }
+}
+
+/*!
+ * Sets entries in type tables to values of NULL type
+ * (GetMutex() must be locked; as plain entries are rewritten, grace period of unregistration must have passed)
+ *
+ * \param uid Uid of entries
+ */
+static void ClearTypeTables(size_t uid)
+{
+  tTypeTables& tables = GetTypeTables();
+  tables.size[uid] = 0;
+  tables.generic_object_size[uid] = 0;
+  tables.type_traits[uid] = 0;
+  tables.classification[uid] = tType::tClassification::NULL_TYPE;
+  tables.name[uid] = tType().GetInternedName();
+  tables.element_type_uid[uid].store(-1, std::memory_order_relaxed);
+  tables.list_type_uid[uid].store(-1, std::memory_order_relaxed);
+  tables.fingerprint[uid].store(0, std::memory_order_relaxed);
+}
+
+/*!
+ * Epoch-based tracking of tType::tUnregistrationGuard objects.
+ * Guards are counted for the parity of the epoch in which they were created.
+ * After removing types, UnregisterBinary() advances the epoch and waits until no guards with the previous parity exist.
+ * As unregistrations are serialized by GetUnregistrationMutex(), no guards with the new parity have been created before the previous unregistration.
+ */
+struct tGuardEpoch
+{
+  std::atomic<size_t> epoch;
+
+  /*! Number of active guards (index is epoch parity) */
+  std::atomic<size_t> guard_count[2];
+
+  tGuardEpoch() : epoch(0)
+  {
+    guard_count[0].store(0);
+    guard_count[1].store(0);
+  }
+};
+
+static tGuardEpoch& GetGuardEpoch()
+{
+  static tGuardEpoch epoch;
+  return epoch;
+}
+
+/*!
+ * Guards of current thread
+ */
+struct tThreadGuardState
+{
+  /*! Nesting depth of guards */
+  size_t depth = 0;
+
+  /*! Epoch parity that outermost guard is counted for */
+  size_t parity = 0;
+};
+
+static tThreadGuardState& GetThreadGuardState()
 {
-  static std::vector<tType> types;
-  types.reserve(cMAX_TYPES); // we need to avoid reallocation in order to make vector thread safe
-  return types;
+  static thread_local tThreadGuardState state;
+  return state;
 }
 
 /*!
- * Helper method that safely provides static data type list
+ * Waits until all guards created before the current epoch was advanced have been destructed
+ * (GetUnregistrationMutex() must be locked - GetMutex() must not be locked, as guard holders may look up or register types)
  */
-static std::vector<tType>& GetTypes()
+static void WaitForGuards()
 {
-  static std::vector<tType>& types = GetTypeVector(); // we introduce an extra method to avoid doing or checking for reserve() on every call
-  assert(types.capacity() >= cMAX_TYPES);
-  return types;
+  tGuardEpoch& guard_epoch = GetGuardEpoch();
+  size_t previous_parity = guard_epoch.epoch.fetch_add(1) & 1;
+  while (guard_epoch.guard_count[previous_parity].load())
+  {
+    std::this_thread::yield();
+  }
 }
 
 /*!
@@ -110,89 +314,358 @@ static size_t& GetLastAnnotationIndex()
 }
 
 /*!
- * Comparator functor for desired order in set returned by GetRenamedTypes()
+ * \return Replacer for demangled names of all types that have been renamed (replaced with their names)
+ */
+static detail::tMultiPatternReplacer& GetRenamedTypes()
+{
+  static detail::tMultiPatternReplacer renamed_types;
+  return renamed_types;
+}
+
+/*!
+ * Result of GetTypeNameFromRtti that is cached for each rtti name
+ */
+struct tRttiNameCacheEntry
+{
+  /*! Demangled rtti name */
+  std::string demangled;
+
+  /*! Type name in rrlib::rtti format */
+  std::string name;
+
+  /*! Type name in rrlib::rtti format without namespaces */
+  std::string name_without_namespaces;
+};
+
+/*!
+ * \return Cache with results of GetTypeNameFromRtti (key is rtti name pointer)
+ */
+static std::unordered_map<const char*, tRttiNameCacheEntry>& GetRttiNameCache()
+{
+  static std::unordered_map<const char*, tRttiNameCacheEntry> cache;
+  return cache;
+}
+
+/*!
+ * Mutex for GetRenamedTypes() and GetRttiNameCache().
+ * Names are computed during initialization of function-local statics (see tDataType<T>::GetDataTypeInfo).
+ * Therefore, no other lock must be acquired while holding this mutex.
+ */
+static std::mutex& GetNameMutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+/*!
+ * Demangled rtti names of types renamed in registration batches whose cached names have not been invalidated yet
+ * (protected by GetNameMutex(); global, so that GetTypeNameFromRtti() returns up-to-date names in all threads;
+ *  committing the outermost batch of any thread invalidates names of all pending types)
+ */
+static std::vector<std::string>& GetPendingRenamedTypes()
+{
+  static std::vector<std::string> pending;
+  return pending;
+}
+
+/*!
+ * \return Number of active (nested) registration batches of the current thread
  */
-struct RenamedTypeCompare
+static size_t& GetRegistrationBatchDepth()
 {
-  bool operator()(tType lhs, tType rhs) const
+  static thread_local size_t depth = 0;
+  return depth;
+}
+
+/*!
+ * \param demangled_name Demangled name of cached entry
+ * \param renamed_type_demangled_names Demangled rtti names of renamed types
+ * \return Whether cached name might change due to renamed types
+ */
+static bool IsAffectedByRenaming(const std::string& demangled_name, const std::vector<std::string>& renamed_type_demangled_names)
+{
+  if (demangled_name.find('<') == std::string::npos)
   {
-    if (lhs.GetRttiNameDemangled().length() != rhs.GetRttiNameDemangled().length())
+    return false;
+  }
+  for (auto & renamed_type_demangled_name : renamed_type_demangled_names)
+  {
+    if (demangled_name.find(renamed_type_demangled_name) != std::string::npos)
     {
-      return lhs.GetRttiNameDemangled().length() > rhs.GetRttiNameDemangled().length();
+      return true;
     }
-    return lhs.GetRttiNameDemangled() < rhs.GetRttiNameDemangled();
   }
+  return false;
+}
+
+/*!
+ * Removes cached names that might change due to newly renamed types
+ * (GetNameMutex() must be locked)
+ *
+ * \param renamed_type_demangled_names Demangled rtti names of renamed types
+ * \return Rtti names whose cached names were removed
+ */
+static std::unordered_set<const char*> InvalidateCachedNames(const std::vector<std::string>& renamed_type_demangled_names)
+{
+  std::unordered_set<const char*> invalidated;
+  auto& cache = GetRttiNameCache();
+  for (auto it = cache.begin(); it != cache.end();)
+  {
+    if (IsAffectedByRenaming(it->second.demangled, renamed_type_demangled_names))
+    {
+      invalidated.insert(it->first);
+      it = cache.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+  return invalidated;
+}
+
+/*!
+ * \param rtti_name Rtti name
+ * \return Demangled rtti name (taken from GetRttiNameCache() if it has already been computed)
+ */
+static std::string GetDemangledName(const char* rtti_name)
+{
+  {
+    std::unique_lock<std::mutex> lock(GetNameMutex());
+    auto& cache = GetRttiNameCache();
+    auto cached = cache.find(rtti_name);
+    if (cached != cache.end())
+    {
+      return cached->second.demangled;
+    }
+  }
+  return util::Demangle(rtti_name);
+}
+
+/*!
+ * Hash indices for FindType (protected by GetMutex())
+ */
+struct tLookupTables
+{
+  /*! Types by name */
+  std::unordered_map<std::string, tType> by_name;
+
+  /*! Types by name derived from rtti (differs from name e.g. if type has been renamed) */
+  std::unordered_map<std::string, tType> by_rtti_derived_name;
+
+  /*! Types by fingerprint */
+  std::unordered_map<uint64_t, tType> by_fingerprint;
+
+  /*! Types by name without namespaces (short names are computed lazily - so types are added on first lookup) */
+  std::unordered_map<std::string, tType> by_short_name;
+
+  /*! Number of types (lowest uids) that have been added to by_short_name */
+  size_t short_names_indexed = 0;
+
+  /*! Types by rtti name pointer */
+  std::unordered_map<const char*, tType> by_rtti_name;
+
+  /*! Types by rtti name string (fallback if a shared library carries its own copy of an rtti name) */
+  std::unordered_map<std::string, tType> by_rtti_name_string;
+
+  /*! Name derived from rtti that each type is currently indexed with (index is uid) */
+  std::vector<std::string> rtti_derived_names;
 };
 
+static tLookupTables& GetLookupTables()
+{
+  static tLookupTables tables;
+  return tables;
+}
+
 /*!
- * \return Set with all types that have been renamed (sorted by length of original demangled name - longest first)
+ * Adds entry to lookup table. If there already is an entry with the same key, the type with the lower uid is kept
+ * (as the linear search did before).
  */
-static std::set<tType, RenamedTypeCompare>& GetRenamedTypes()
+template <typename TKey>
+static void AddLookupEntry(std::unordered_map<TKey, tType>& table, const TKey& key, tType type)
 {
-  static std::set<tType, RenamedTypeCompare> renamed_types;
-  return renamed_types;
+  auto result = table.emplace(key, type);
+  if ((!result.second) && result.first->second.GetUid() > type.GetUid())
+  {
+    result.first->second = type;
+  }
 }
 
 /*!
- * Replaces std container names in string that is provided
+ * Adds type to the lookup tables that do not depend on names derived from rtti
+ * (GetMutex() must be locked)
  *
- * \param type_name Type name string to modify
+ * \param type Type to add
  */
-static void ReplaceContainerNames(std::string& type_name)
+static void AddToLookupTables(tType type)
 {
-  static const std::unordered_map<std::string, std::string> cTEMPLATE_NAMES = { {"std::vector<", "List"}, {"std::set<", "Set"}, {"std::map<", "Map"}, {"std::tuple<", "Tuple"} };
-  static const std::string cREMOVE_LAST_ARG = "std::allocator<";
+  tLookupTables& tables = GetLookupTables();
+  AddLookupEntry(tables.by_name, type.GetName(), type);
+  tables.by_rtti_name.emplace(type.GetRttiName(), type);
+  if (strstr(type.GetRttiName(), "_GLOBAL__N") == NULL) // types in anonymous namespaces of different translation units may have identical rtti names
+  {
+    tables.by_rtti_name_string.emplace(type.GetRttiName(), type);
+  }
+}
 
-  for (auto & entry : cTEMPLATE_NAMES)
+/*!
+ * Adds type to fingerprint lookup table
+ * (GetMutex() must be locked)
+ *
+ * \param type Type to add
+ * \param warn_on_fingerprint_collision Whether to print a warning if another type with a different name has the same fingerprint
+ */
+static void AddFingerprintEntry(tType type, bool warn_on_fingerprint_collision)
+{
+  tLookupTables& tables = GetLookupTables();
+  auto fingerprint_entry = tables.by_fingerprint.find(type.GetFingerprint());
+  if (fingerprint_entry != tables.by_fingerprint.end() && fingerprint_entry->second.GetName() != type.GetName())
   {
-    bool word_start = true;
-    for (size_t i = 0; i < type_name.length(); i++)
+    if (warn_on_fingerprint_collision)
     {
-      if (word_start && type_name.compare(i, entry.first.length(), entry.first) == 0)
+      RRLIB_LOG_PRINT_STATIC(WARNING, "Types '", fingerprint_entry->second.GetName(), "' and '", type.GetName(), "' have the same fingerprint. Type '", type.GetName(), "' cannot be found by fingerprint.");
+    }
+  }
+  else
+  {
+    AddLookupEntry(tables.by_fingerprint, type.GetFingerprint(), type);
+  }
+}
+
+/*!
+ * Sets fingerprint of type and updates fingerprint lookup table
+ * (GetMutex() must be locked)
+ *
+ * \param type Type
+ * \param final_name Name of type with all renamings applied (also those of types registered later - e.g. element type of a list type).
+ *                   As it does not depend on the order in which types are registered, fingerprints are identical in all processes.
+ */
+static void SetFingerprint(tType type, const std::string& final_name)
+{
+  tLookupTables& tables = GetLookupTables();
+  std::atomic<uint64_t>* fingerprints = GetTypeTables().fingerprint;
+  size_t uid = static_cast<size_t>(type.GetUid());
+  uint64_t current_fingerprint = fingerprints[uid].load(std::memory_order_relaxed);
+  uint64_t fingerprint = tType::GetFingerprint(final_name);
+  if (current_fingerprint == fingerprint)
+  {
+    return;
+  }
+
+  // Remove old entry
+  auto it = tables.by_fingerprint.find(current_fingerprint);
+  bool removed = it != tables.by_fingerprint.end() && it->second == type;
+  if (removed)
+  {
+    tables.by_fingerprint.erase(it);
+  }
+
+  fingerprints[uid].store(fingerprint, std::memory_order_relaxed);
+  AddFingerprintEntry(type, true);
+  if (removed)
+  {
+    size_t type_count = GetTypes().size.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < type_count; i++)
+    {
+      tType other = GetTypes().types[i].load(std::memory_order_relaxed);
+      if (i != uid && other != NULL && fingerprints[i].load(std::memory_order_relaxed) == current_fingerprint)
       {
-        // search for end of template
-        size_t bracket_count = 1;
-        size_t last_template_argument_start = 0;
-        size_t last_index = 0;
-        for (size_t index = i + entry.first.length(); index < type_name.length(); index++)
-        {
-          if (type_name[index] == '<')
-          {
-            bracket_count++;
-          }
-          else if (type_name[index] == '>')
-          {
-            bracket_count--;
-            if (bracket_count == 0)
-            {
-              last_index = index;
-              break;
-            }
-          }
-          else if (bracket_count == 1 && type_name[index] == ',')
-          {
-            last_template_argument_start = index;
-          }
-        }
+        AddFingerprintEntry(other, false);
+      }
+    }
+  }
+}
 
-        if (last_template_argument_start && last_index)
-        {
-          // Remove last template argument?
-          if (type_name.compare(last_template_argument_start + 1, cREMOVE_LAST_ARG.length(), cREMOVE_LAST_ARG) == 0 ||
-              type_name.compare(last_template_argument_start + 2, cREMOVE_LAST_ARG.length(), cREMOVE_LAST_ARG) == 0)
-          {
-            type_name.replace(last_template_argument_start, last_index - last_template_argument_start, "");
-          }
-
-          // Replace template name
-          type_name.replace(i, entry.first.length() - 1, entry.second);
-
-          i = 0;
-          word_start = true;
-          continue;
-        }
+/*!
+ * Sets name derived from rtti that type is indexed with (also sets fingerprint - see SetFingerprint())
+ * (GetMutex() must be locked)
+ *
+ * \param type Type
+ * \param rtti_derived_name New name derived from rtti
+ */
+static void SetRttiDerivedName(tType type, const std::string& rtti_derived_name)
+{
+  tLookupTables& tables = GetLookupTables();
+  size_t uid = static_cast<size_t>(type.GetUid());
+  if (tables.rtti_derived_names.size() <= uid)
+  {
+    tables.rtti_derived_names.resize(uid + 1);
+  }
+  std::string& current_name = tables.rtti_derived_names[uid];
+  if (current_name == rtti_derived_name)
+  {
+    return;
+  }
+
+  // Remove old entry
+  auto it = tables.by_rtti_derived_name.find(current_name);
+  if (it != tables.by_rtti_derived_name.end() && it->second == type)
+  {
+    tables.by_rtti_derived_name.erase(it);
+    for (size_t i = 0; i < tables.rtti_derived_names.size(); i++)
+    {
+      if (i != uid && tables.rtti_derived_names[i] == current_name)
+      {
+        AddLookupEntry(tables.by_rtti_derived_name, current_name, tType::GetType(static_cast<int16_t>(i)));
       }
-      word_start = !isalnum(type_name[i]);
+    }
+  }
+
+  current_name = rtti_derived_name;
+  AddLookupEntry(tables.by_rtti_derived_name, current_name, type);
+  SetFingerprint(type, rtti_derived_name);
+}
+
+/*!
+ * Updates names derived from rtti of registered types whose cached names were invalidated
+ * (GetMutex() must be locked)
+ *
+ * \param invalidated_names Rtti names whose cached names were invalidated (see InvalidateCachedNames())
+ */
+static void UpdateRttiDerivedNames(const std::unordered_set<const char*>& invalidated_names)
+{
+  if (invalidated_names.empty())
+  {
+    return;
+  }
+  tTypeRegistry& registry = GetTypes();
+  size_t type_count = registry.size.load(std::memory_order_relaxed);
+  for (size_t i = 0; i < type_count; i++)
+  {
+    tType type = registry.types[i].load(std::memory_order_relaxed);
+    if (type != NULL && invalidated_names.count(type.GetRttiName()))
+    {
+      SetRttiDerivedName(type, tType::GetTypeNameFromRtti(type.GetRttiName()));
+    }
+  }
+}
+
+/*!
+ * Rebuilds all lookup tables from the registered types
+ * (GetMutex() must be locked; name derived from rtti must be set for all registered types)
+ */
+static void RebuildLookupTables()
+{
+  tLookupTables& tables = GetLookupTables();
+  tables.by_name.clear();
+  tables.by_rtti_derived_name.clear();
+  tables.by_fingerprint.clear();
+  tables.by_short_name.clear();
+  tables.short_names_indexed = 0;
+  tables.by_rtti_name.clear();
+  tables.by_rtti_name_string.clear();
+
+  tTypeRegistry& registry = GetTypes();
+  size_t type_count = registry.size.load(std::memory_order_relaxed);
+  for (size_t i = 0; i < type_count; i++)
+  {
+    tType type = registry.types[i].load(std::memory_order_relaxed);
+    if (type != NULL)
+    {
+      AddToLookupTables(type);
+      AddLookupEntry(tables.by_rtti_derived_name, tables.rtti_derived_names[i], type);
+      AddFingerprintEntry(type, false);
     }
   }
 }
@@ -205,36 +678,124 @@ tType::tType(tType::tInfo* info) :
 {
   if (info && info->new_info)
   {
+#if RRLIB_RTTI_REGISTRATION_PROFILING_ENABLED
+    detail::tRegistrationProfiler::BeginRegistration(info);
+#endif
+
     // Add data type to registry
-    std::unique_lock<std::recursive_mutex> lock(internal::GetMutex());
-    info->uid = static_cast<int16_t>(internal::GetTypes().size());
-    if (internal::GetTypes().size() >= cMAX_TYPES)
+    std::unique_lock<std::recursive_mutex> lock(internal::GetMutex(), std::defer_lock);
+    {
+      RRLIB_RTTI_PROFILE_REGISTRATION_PHASE(MUTEX_WAIT);
+      lock.lock();
+    }
+    internal::tTypeRegistry& registry = internal::GetTypes();
+    size_t type_count = registry.size.load(std::memory_order_relaxed);
+    if (registry.free_uids.size())
     {
-      RRLIB_LOG_PRINT(ERROR, "Maximum number of data types exceeded. Increase cMAX_TYPES.");
-      throw std::runtime_error("Maximum number of data types exceeded. Increase cMAX_TYPES.");
+      info->uid = registry.free_uids.back();
+      registry.free_uids.pop_back();
+      UpdateTables(*info);
+      registry.types[info->uid].store(*this, std::memory_order_release);
+    }
+    else
+    {
+      if (type_count >= cMAX_TYPES)
+      {
+        RRLIB_LOG_PRINT(ERROR, "Maximum number of data types exceeded (uids are 16 bit).");
+        throw std::runtime_error("Maximum number of data types exceeded (uids are 16 bit).");
+      }
+      info->uid = static_cast<int16_t>(type_count);
+      UpdateTables(*info);
+      registry.types.GetOrCreate(type_count).store(*this, std::memory_order_release);
+      registry.size.store(type_count + 1, std::memory_order_release);
     }
-    internal::GetTypes().push_back(*this);
     info->new_info = false;
     RRLIB_LOG_PRINT(DEBUG_VERBOSE_1, "Adding data type ", GetName());
 
-    // Add to string replacement table?
-    if (GetTypeNameFromRtti(info->rtti_name) != info->name)
+    // Update table entries of related types registered before
+    for (const tInfo* related_info : { info->element_type, info->list_type })
     {
-      internal::GetRenamedTypes().insert(*this);
+      if (related_info && (!related_info->new_info))
+      {
+        UpdateRelatedTypeTables(*related_info);
+      }
+    }
+
+    // Add to lookup tables
+    internal::tLookupTables& lookup_tables = internal::GetLookupTables();
+    internal::AddToLookupTables(*this);
+    if (static_cast<size_t>(info->uid) < lookup_tables.short_names_indexed) // reused uid
+    {
+      internal::AddLookupEntry(lookup_tables.by_short_name, GetName(true), *this);
+    }
+    std::string rtti_derived_name = GetTypeNameFromRtti(info->rtti_name);
+    internal::SetRttiDerivedName(*this, rtti_derived_name);
 
-      // Debug output
-      /*RRLIB_LOG_PRINT(DEBUG, "Content:");
-      for (auto it = internal::GetRenamedTypes().begin(); it != internal::GetRenamedTypes().end(); ++it)
+    // Add to string replacement table?
+    if (rtti_derived_name != info->name)
+    {
+      const std::string& demangled_rtti_name = info->GetDemangledRttiName();
+      std::unordered_set<const char*> invalidated_names;
       {
-        RRLIB_LOG_PRINT(DEBUG, it->info->demangled_rtti_name);
-      }*/
+        std::unique_lock<std::mutex> name_lock(internal::GetNameMutex());
+        internal::GetRenamedTypes().AddPattern(demangled_rtti_name, info->name);
+        if (internal::GetRegistrationBatchDepth())
+        {
+          internal::GetPendingRenamedTypes().push_back(demangled_rtti_name); // cache is invalidated when batch is committed
+        }
+        else
+        {
+          invalidated_names = internal::InvalidateCachedNames(std::vector<std::string>(1, demangled_rtti_name));
+        }
+      }
+
+      internal::SetFingerprint(*this, info->name); // name derived from rtti remains the one without renaming
+
+      // Names derived from rtti might change for template types containing this type
+      internal::UpdateRttiDerivedNames(invalidated_names);
+    }
+
+    {
+      RRLIB_RTTI_PROFILE_REGISTRATION_PHASE(INIT);
+      info->Init();
     }
 
-    info->Init();
+#if RRLIB_RTTI_REGISTRATION_PROFILING_ENABLED
+    detail::tRegistrationProfiler::EndRegistration(info->name, info->binary, info->uid);
+#endif
+  }
+}
+
+tType::tRegistrationBatch::tRegistrationBatch()
+{
+  if (internal::GetRegistrationBatchDepth()++ == 0)
+  {
+    std::unique_lock<std::mutex> name_lock(internal::GetNameMutex());
+    internal::GetRenamedTypes().BeginDeferringLinkUpdates();
+  }
+}
+
+tType::tRegistrationBatch::~tRegistrationBatch()
+{
+  if (--internal::GetRegistrationBatchDepth() == 0)
+  {
+    std::unique_lock<std::recursive_mutex> lock(internal::GetMutex());
+    std::unordered_set<const char*> invalidated_names;
+    {
+      std::unique_lock<std::mutex> name_lock(internal::GetNameMutex());
+      internal::GetRenamedTypes().EndDeferringLinkUpdates();
+      auto& pending_renamed_types = internal::GetPendingRenamedTypes();
+      if (pending_renamed_types.size())
+      {
+        invalidated_names = internal::InvalidateCachedNames(pending_renamed_types);
+        pending_renamed_types.clear();
+      }
+    }
+    internal::UpdateRttiDerivedNames(invalidated_names);
   }
 }
 
-void tType::AddAnnotationImplementation(tTypeAnnotation* annotation, bool (*annotation_index_valid_function)(bool), int& annotation_index)
+void tType::AddAnnotationImplementation(tTypeAnnotation* annotation, bool (*annotation_index_valid_function)(bool), std::atomic<int>& annotation_index)
 {
   if (!annotation)
   {
@@ -252,30 +813,32 @@ void tType::AddAnnotationImplementation(tTypeAnnotation* annotation, bool (*anno
   if (info)
   {
     annotation->annotated_type = *this;
-    size_t ann_index = -1u;
 
     if (!(*annotation_index_valid_function)(false))
     {
       last_annotation_index++;
-      if (last_annotation_index >= cMAX_ANNOTATIONS)
-      {
-        RRLIB_LOG_PRINT(ERROR, "Maximum number of annotations (tType::cMAX_ANNOTATIONS) exceeded. Aborting.");
-        abort();
-      }
-      annotation_index = last_annotation_index;
+      annotation_index.store(static_cast<int>(last_annotation_index), std::memory_order_relaxed);
       (*annotation_index_valid_function)(true);
     }
-    ann_index = annotation_index;
+    size_t ann_index = static_cast<size_t>(annotation_index.load(std::memory_order_relaxed));
+    assert(ann_index > 0);
 
-    assert(ann_index > 0 && ann_index < cMAX_ANNOTATIONS);
+    // Replace annotation array with a larger one if required (readers may still use the old one)
+    std::atomic<tAnnotations*>& info_annotations = const_cast<tInfo*>(info)->annotations;
+    tAnnotations* annotations = info_annotations.load(std::memory_order_relaxed);
+    if ((!annotations) || ann_index >= annotations->size)
+    {
+      annotations = new tAnnotations(std::max<size_t>(ann_index + 1, 2 * last_annotation_index), annotations);
+      info_annotations.store(annotations, std::memory_order_release);
+    }
 
-    if (info->annotations[ann_index])
+    if (annotations->entries[ann_index].load(std::memory_order_relaxed))
     {
       RRLIB_LOG_PRINT(ERROR, "An annotation with this type was already to data type '", GetName(), "'. Aborting.");
       abort();
     }
 
-    const_cast<tInfo*>(info)->annotations[ann_index] = annotation;
+    annotations->entries[ann_index].store(annotation, std::memory_order_release);
   }
   else
   {
@@ -283,11 +846,21 @@ void tType::AddAnnotationImplementation(tTypeAnnotation* annotation, bool (*anno
   }
 }
 
+tGenericArray tType::CreateArrayGeneric(size_t count) const
+{
+  return tGenericArray(*this, count);
+}
+
+tGenericObject* tType::CreateInstanceGeneric(tGenericObjectArena& arena) const
+{
+  return arena.CreateInstance(*this);
+}
+
 void tType::DeepCopy(const void* source, void* destination, tFactory* factory) const
 {
   if (info)
   {
-    info->DeepCopy(source, destination, factory);
+    info->operations.deep_copy(source, destination, factory);
   }
   else
   {
@@ -295,6 +868,14 @@ void tType::DeepCopy(const void* source, void* destination, tFactory* factory) c
   }
 }
 
+void tType::DestroyInstanceGeneric(tGenericObject* object)
+{
+  if (object)
+  {
+    object->~tGenericObject();
+  }
+}
+
 tType tType::FindType(const std::string& name)
 {
   if (name.compare("NULL") == 0)
@@ -302,21 +883,18 @@ tType tType::FindType(const std::string& name)
     return tType();
   }
 
-  for (auto it = internal::GetTypes().begin(); it != internal::GetTypes().end(); ++it)
+  std::unique_lock<std::recursive_mutex> lock(internal::GetMutex());
+  internal::tLookupTables& tables = internal::GetLookupTables();
+  auto it = tables.by_name.find(name);
+  if (it != tables.by_name.end())
   {
-    if (name.compare(it->info->name) == 0)
-    {
-      return *it;
-    }
+    return it->second;
   }
 
-  bool try_to_lookup_old_names = true;
-  for (auto it = internal::GetTypes().begin(); try_to_lookup_old_names && it != internal::GetTypes().end(); ++it)
+  it = tables.by_rtti_derived_name.find(name);
+  if (it != tables.by_rtti_derived_name.end())
   {
-    if (name == it->GetTypeNameFromRtti(it->info->rtti_name, false))
-    {
-      return *it;
-    }
+    return it->second;
   }
 
   if (name.find('.') != std::string::npos) // namespaces in specified name
@@ -325,55 +903,85 @@ tType tType::FindType(const std::string& name)
   }
   else // no namespace in specified name
   {
-    for (auto it = internal::GetTypes().begin(); it != internal::GetTypes().end(); ++it)
+    for (size_t type_count = GetTypeCount(); tables.short_names_indexed < type_count; tables.short_names_indexed++)
     {
-      if (name.compare(it->info->short_name) == 0)
+      tType type = GetType(static_cast<int16_t>(tables.short_names_indexed));
+      if (type != NULL)
       {
-        return *it;
+        internal::AddLookupEntry(tables.by_short_name, type.GetName(true), type);
       }
     }
+    it = tables.by_short_name.find(name);
+    if (it != tables.by_short_name.end())
+    {
+      return it->second;
+    }
   }
 
   return tType();
 }
 
+uint64_t tType::GetFingerprint() const
+{
+  if (info && info->uid >= 0)
+  {
+    return internal::GetTypeTables().fingerprint[info->uid].load(std::memory_order_relaxed);
+  }
+  return info ? GetFingerprint(info->name) : 0;
+}
+
+tType tType::FindTypeByFingerprint(uint64_t fingerprint)
+{
+  std::unique_lock<std::recursive_mutex> lock(internal::GetMutex());
+  internal::tLookupTables& tables = internal::GetLookupTables();
+  auto it = tables.by_fingerprint.find(fingerprint);
+  return it != tables.by_fingerprint.end() ? it->second : tType();
+}
+
 tType tType::FindTypeByRtti(const char* rtti_name)
 {
-  for (auto it = internal::GetTypes().begin(); it != internal::GetTypes().end(); ++it)
+  std::unique_lock<std::recursive_mutex> lock(internal::GetMutex());
+  internal::tLookupTables& tables = internal::GetLookupTables();
+  auto it = tables.by_rtti_name.find(rtti_name);
+  if (it != tables.by_rtti_name.end())
   {
-    if (it->info->rtti_name == rtti_name)
-    {
-      return *it;
-    }
+    return it->second;
+  }
+
+  auto string_it = tables.by_rtti_name_string.find(rtti_name);
+  if (string_it != tables.by_rtti_name_string.end())
+  {
+    return string_it->second;
   }
   return tType();
 }
 
 std::string tType::GetTypeNameFromRtti(const char* rtti, bool remove_namespaces)
 {
-  std::string demangled = util::Demangle(rtti);
+  RRLIB_RTTI_PROFILE_REGISTRATION_PHASE(NAME_COMPUTATION);
+  std::unique_lock<std::mutex> lock(internal::GetNameMutex());
+  auto& cache = internal::GetRttiNameCache();
+  auto cached = cache.find(rtti);
+  if (cached != cache.end())
+  {
+    auto& pending_renamed_types = internal::GetPendingRenamedTypes();
+    if (pending_renamed_types.empty() || (!internal::IsAffectedByRenaming(cached->second.demangled, pending_renamed_types)))
+    {
+      return remove_namespaces ? cached->second.name_without_namespaces : cached->second.name;
+    }
+    cache.erase(cached);
+  }
+
+  internal::tRttiNameCacheEntry entry;
+  entry.demangled = util::Demangle(rtti);
+  std::string demangled = entry.demangled;
 
   // Do we have a template? => check for string replacements
   if (demangled.find('<') != std::string::npos)
   {
-    internal::ReplaceContainerNames(demangled);
-
-    // TODO: std::regex might be more convenient (available on all relevant platforms?)
-    for (auto it = internal::GetRenamedTypes().begin(); it != internal::GetRenamedTypes().end(); ++it)
-    {
-      size_t found_index = 0;
+    demangled = detail::ReplaceContainerNames(demangled, cCONTAINER_NAMES, sizeof(cCONTAINER_NAMES) / sizeof(cCONTAINER_NAMES[0]));
 
-      while ((found_index = demangled.find(it->GetRttiNameDemangled(), found_index + 1)) != std::string::npos)
-      {
-        // we only want to replace whole words => character before and after must not be a letter
-        if ((!isalnum(demangled[found_index - 1])) && found_index + it->GetRttiNameDemangled().length() < demangled.length() &&
-            (!isalnum(demangled[found_index + it->GetRttiNameDemangled().length()])))
-        {
-          demangled.replace(found_index, it->GetRttiNameDemangled().length(), it->GetName());
-          found_index = 0;
-        }
-      }
-    }
+    internal::GetRenamedTypes().Replace(demangled);
   }
 
   // Replace '::' with '.', remove 't' prefixes, replace '> >' with '>>'
@@ -410,26 +1018,299 @@ std::string tType::GetTypeNameFromRtti(const char* rtti, bool remove_namespaces)
     }
   }
 
-  if (remove_namespaces)
+  entry.name = name;
+  entry.name_without_namespaces = RemoveNamespaces(entry.name);
+  cached = cache.emplace(rtti, std::move(entry)).first;
+  return remove_namespaces ? cached->second.name_without_namespaces : cached->second.name;
+}
+
+namespace detail
+{
+
+std::string AddCompileTimeTypeName(const char* rtti_name, const char* demangled_name, size_t demangled_name_length, const char* name)
+{
+  RRLIB_RTTI_PROFILE_REGISTRATION_PHASE(NAME_COMPUTATION);
+  std::unique_lock<std::mutex> lock(internal::GetNameMutex());
+  auto& cache = internal::GetRttiNameCache();
+  auto cached = cache.find(rtti_name);
+  if (cached == cache.end())
   {
-    return RemoveNamespaces(name);
+    internal::tRttiNameCacheEntry entry;
+    entry.demangled.assign(demangled_name, demangled_name_length);
+    entry.name = name;
+    entry.name_without_namespaces = entry.name.substr(entry.name.rfind('.') + 1); // equivalent to RemoveNamespaces() for names without templates
+    cached = cache.emplace(rtti_name, std::move(entry)).first;
   }
+  return cached->second.name;
+}
 
-  return name;
+}
+
+uint64_t tType::GetFingerprint(const std::string& type_name)
+{
+  // 64 bit FNV-1a
+  uint64_t hash = 14695981039346656037ULL;
+  for (char c : type_name)
+  {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
 }
 
 tType tType::GetType(int16_t uid)
 {
-  if (uid <= -1 || static_cast<size_t>(uid) >= internal::GetTypes().size())
+  internal::tTypeRegistry& registry = internal::GetTypes();
+  if (uid <= -1 || static_cast<size_t>(uid) >= registry.size.load(std::memory_order_acquire))
   {
     return tType();
   }
-  return internal::GetTypes()[uid];
+  return registry.types[uid].load(std::memory_order_acquire);
 }
 
 uint16_t tType::GetTypeCount()
 {
-  return static_cast<uint16_t>(internal::GetTypes().size());
+  return static_cast<uint16_t>(internal::GetTypes().size.load(std::memory_order_acquire));
+}
+
+tSpan<tType::tClassification> tType::GetClassificationTable()
+{
+  return tSpan<tClassification>(internal::GetTypeTables().classification, GetTypeCount());
+}
+
+tSpan<std::atomic<int16_t>> tType::GetElementTypeUidTable()
+{
+  return tSpan<std::atomic<int16_t>>(internal::GetTypeTables().element_type_uid, GetTypeCount());
+}
+
+tSpan<std::atomic<int16_t>> tType::GetListTypeUidTable()
+{
+  return tSpan<std::atomic<int16_t>>(internal::GetTypeTables().list_type_uid, GetTypeCount());
+}
+
+tSpan<tInternedName> tType::GetNameTable()
+{
+  return tSpan<tInternedName>(internal::GetTypeTables().name, GetTypeCount());
+}
+
+tSpan<size_t> tType::GetSizeTable(bool as_generic_object)
+{
+  internal::tTypeTables& tables = internal::GetTypeTables();
+  return tSpan<size_t>(as_generic_object ? tables.generic_object_size : tables.size, GetTypeCount());
+}
+
+tSpan<int> tType::GetTypeTraitsTable()
+{
+  return tSpan<int>(internal::GetTypeTables().type_traits, GetTypeCount());
+}
+
+tTypeSet tType::GetTypesWithAllTraits(int traits)
+{
+  internal::tTraitBitVectors& bit_vectors = internal::GetTraitBitVectors();
+  size_t type_count = GetTypeCount();
+  tTypeSet result;
+  result.words.resize((type_count + 63) / 64);
+  for (size_t word = 0; word < result.words.size(); word++)
+  {
+    uint64_t bits = bit_vectors.registered[word].load(std::memory_order_relaxed);
+    for (size_t i = 0; i < cTRAIT_COUNT && bits; i++)
+    {
+      if (static_cast<unsigned int>(traits) & (1u << i))
+      {
+        bits &= bit_vectors.traits[i][word].load(std::memory_order_relaxed);
+      }
+    }
+    result.words[word] = bits;
+  }
+  internal::MaskUnusedUids(result.words, type_count);
+  return result;
+}
+
+tTypeSet tType::GetTypesWithAnyTrait(int traits)
+{
+  internal::tTraitBitVectors& bit_vectors = internal::GetTraitBitVectors();
+  size_t type_count = GetTypeCount();
+  tTypeSet result;
+  result.words.resize((type_count + 63) / 64);
+  for (size_t word = 0; word < result.words.size(); word++)
+  {
+    uint64_t bits = 0;
+    for (size_t i = 0; i < cTRAIT_COUNT; i++)
+    {
+      if (static_cast<unsigned int>(traits) & (1u << i))
+      {
+        bits |= bit_vectors.traits[i][word].load(std::memory_order_relaxed);
+      }
+    }
+    result.words[word] = bits & bit_vectors.registered[word].load(std::memory_order_relaxed);
+  }
+  internal::MaskUnusedUids(result.words, type_count);
+  return result;
+}
+
+size_t tType::UnregisterBinary(const std::string& binary)
+{
+  if (binary.length() == 0)
+  {
+    RRLIB_LOG_PRINT(WARNING, "No binary specified. Types that were not registered during static initialization cannot be unregistered.");
+    return 0;
+  }
+  if (internal::GetThreadGuardState().depth)
+  {
+    RRLIB_LOG_PRINT(ERROR, "Types cannot be unregistered while the current thread holds a tUnregistrationGuard (deadlock).");
+    throw std::logic_error("Types cannot be unregistered while the current thread holds a tUnregistrationGuard");
+  }
+
+  std::unique_lock<std::mutex> unregistration_lock(internal::GetUnregistrationMutex());
+  std::unique_lock<std::recursive_mutex> lock(internal::GetMutex());
+  internal::tTypeRegistry& registry = internal::GetTypes();
+  internal::tLookupTables& tables = internal::GetLookupTables();
+  size_t type_count = registry.size.load(std::memory_order_relaxed);
+
+  // Remove types from registry
+  std::unordered_set<const tInfo*> removed_infos;
+  std::vector<int16_t> removed_uids;
+  std::vector<std::string> removed_renamed_types;
+  for (size_t i = 0; i < type_count; i++)
+  {
+    tType type = registry.types[i].load(std::memory_order_relaxed);
+    if (type != NULL && (type.GetBinary(true) == binary || type.GetBinary(false) == binary))
+    {
+      RRLIB_LOG_PRINT(DEBUG_VERBOSE_1, "Removing data type ", type.GetName());
+      if (tables.rtti_derived_names[i] != type.GetName())
+      {
+        removed_renamed_types.push_back(type.GetRttiNameDemangled());
+      }
+      removed_infos.insert(type.info);
+      removed_uids.push_back(static_cast<int16_t>(i));
+      registry.types[i].store(tType(), std::memory_order_release);
+      internal::ClearTraitBits(i);
+      tables.rtti_derived_names[i].clear();
+    }
+  }
+  if (removed_uids.empty())
+  {
+    return 0;
+  }
+
+  // Remove references from remaining types
+  std::unordered_set<const char*> remaining_rtti_names;
+  for (size_t i = 0; i < type_count; i++)
+  {
+    tType type = registry.types[i].load(std::memory_order_relaxed);
+    if (type != NULL)
+    {
+      tInfo* info = const_cast<tInfo*>(type.info);
+      remaining_rtti_names.insert(info->rtti_name);
+      if (removed_infos.count(info->element_type))
+      {
+        info->element_type = NULL;
+      }
+      if (removed_infos.count(info->list_type))
+      {
+        info->list_type = NULL;
+      }
+      if (removed_infos.count(info->shared_ptr_list_type))
+      {
+        info->shared_ptr_list_type = NULL;
+      }
+      UpdateRelatedTypeTables(*info);
+    }
+  }
+
+  // Names of template types containing removed types might change
+  std::unordered_set<const char*> invalidated_names;
+  {
+    std::unique_lock<std::mutex> name_lock(internal::GetNameMutex());
+    for (auto & removed_renamed_type : removed_renamed_types)
+    {
+      internal::GetRenamedTypes().RemovePattern(removed_renamed_type);
+    }
+    invalidated_names = internal::InvalidateCachedNames(removed_renamed_types);
+
+    // Keys of other entries might point to rtti names in the binary that is about to be unloaded.
+    // Entries of remaining types are kept, as InvalidateCachedNames() relies on them when types are renamed later.
+    auto& cache = internal::GetRttiNameCache();
+    for (auto it = cache.begin(); it != cache.end();)
+    {
+      it = remaining_rtti_names.count(it->first) ? std::next(it) : cache.erase(it);
+    }
+  }
+  internal::RebuildLookupTables();
+  internal::UpdateRttiDerivedNames(invalidated_names);
+
+  // Wait for grace period before uids may be reused (without blocking guard holders that look up or register types)
+  lock.unlock();
+  internal::WaitForGuards();
+  lock.lock();
+  for (int16_t uid : removed_uids)
+  {
+    internal::ClearTypeTables(uid);
+  }
+  detail::tTypeSideTableBase::ResetEntries(removed_uids); // after grace period, as guard holders might still set entries
+  registry.free_uids.insert(registry.free_uids.end(), removed_uids.begin(), removed_uids.end());
+  std::sort(registry.free_uids.begin(), registry.free_uids.end(), std::greater<int16_t>());
+  return removed_uids.size();
+}
+
+void tType::UpdateTables(const tInfo& info)
+{
+  internal::tTypeTables& tables = internal::GetTypeTables();
+  size_t uid = static_cast<size_t>(info.uid);
+  tables.size[uid] = info.size;
+  tables.generic_object_size[uid] = info.generic_object_size;
+  tables.type_traits[uid] = info.type_traits;
+  tables.classification[uid] = info.type;
+  tables.name[uid] = info.interned_name;
+  UpdateRelatedTypeTables(info);
+
+  internal::tTraitBitVectors& bit_vectors = internal::GetTraitBitVectors();
+  uint64_t bit = static_cast<uint64_t>(1) << (uid % 64);
+  for (size_t i = 0; i < cTRAIT_COUNT; i++)
+  {
+    if (static_cast<unsigned int>(info.type_traits) & (1u << i))
+    {
+      bit_vectors.traits[i][uid / 64].fetch_or(bit);
+    }
+  }
+  bit_vectors.registered[uid / 64].fetch_or(bit);
+}
+
+void tType::UpdateRelatedTypeTables(const tInfo& info)
+{
+  internal::tTypeTables& tables = internal::GetTypeTables();
+  size_t uid = static_cast<size_t>(info.uid);
+  tables.element_type_uid[uid].store((info.element_type && (!info.element_type->new_info)) ? info.element_type->uid : -1, std::memory_order_relaxed);
+  tables.list_type_uid[uid].store((info.list_type && (!info.list_type->new_info)) ? info.list_type->uid : -1, std::memory_order_relaxed);
+}
+
+tType::tUnregistrationGuard::tUnregistrationGuard()
+{
+  internal::tThreadGuardState& state = internal::GetThreadGuardState();
+  if (state.depth++ == 0)
+  {
+    internal::tGuardEpoch& guard_epoch = internal::GetGuardEpoch();
+    while (true)
+    {
+      size_t parity = guard_epoch.epoch.load() & 1;
+      guard_epoch.guard_count[parity]++;
+      if ((guard_epoch.epoch.load() & 1) == parity)
+      {
+        state.parity = parity;
+        break;
+      }
+      guard_epoch.guard_count[parity]--; // epoch was advanced concurrently
+    }
+  }
+}
+
+tType::tUnregistrationGuard::~tUnregistrationGuard()
+{
+  internal::tThreadGuardState& state = internal::GetThreadGuardState();
+  if (--state.depth == 0)
+  {
+    internal::GetGuardEpoch().guard_count[state.parity]--;
+  }
 }
 
 std::string tType::RemoveNamespaces(const std::string& type_name)
@@ -461,41 +1342,132 @@ std::string tType::RemoveNamespaces(const std::string& type_name)
   return result_ptr;
 }
 
+namespace internal
+{
+
+// Operations of types without implementation (see tType::cNO_OPERATIONS)
+
+static void NoConstruct(void*, size_t)
+{
+  RRLIB_LOG_PRINT_STATIC(ERROR, "Not implemented for this type");
+}
+
+static void NoDestruct(void*, size_t)
+{
+  RRLIB_LOG_PRINT_STATIC(ERROR, "Not implemented for this type");
+}
+
+static void NoDeepCopy(const void*, void*, tFactory*)
+{
+  RRLIB_LOG_PRINT_STATIC(ERROR, "Not implemented for this type");
+}
+
+static void NoMoveConstruct(void*, void*)
+{
+  RRLIB_LOG_PRINT_STATIC(ERROR, "Not implemented for this type");
+}
+
+static bool NoEquals(const void*, const void*)
+{
+  RRLIB_LOG_PRINT_STATIC(ERROR, "Not implemented for this type");
+  return false;
+}
+
+static void NoSerialize(serialization::tOutputStream&, const void*)
+{
+  RRLIB_LOG_PRINT_STATIC(ERROR, "Not implemented for this type");
+}
+
+static void NoDeserialize(serialization::tInputStream&, void*)
+{
+  RRLIB_LOG_PRINT_STATIC(ERROR, "Not implemented for this type");
+}
+
+}
+
+// Function pointers are constant-initialized - so the table can be used during static initialization
+const tType::tOperations tType::cNO_OPERATIONS =
+{
+  &internal::NoConstruct,
+  &internal::NoDestruct,
+  &internal::NoDeepCopy,
+  &internal::NoMoveConstruct,
+  &internal::NoEquals,
+  &internal::NoSerialize,
+  &internal::NoDeserialize
+};
+
 tType::tInfo::tInfo(tType::tClassification classification, const char* rtti_name, const std::string& name) :
   type(classification),
-  name(name),
-  short_name(RemoveNamespaces(name)),
+  interned_name(name),
+  name(interned_name.GetString()),
   rtti_name(rtti_name),
-  demangled_rtti_name(rrlib::util::Demangle(rtti_name)),
   size(0),
   generic_object_size(0),
+  alignment(0),
+  generic_object_alignment(0),
+  emplaced_generic_object_size(0),
   type_traits(0),
   new_info(true),
   uid(-1),
   element_type(NULL),
   list_type(NULL),
   shared_ptr_list_type(NULL),
+  annotations(NULL),
   binary(),
   enum_strings(NULL),
-  non_standard_enum_value_strings()
+  non_standard_enum_value_strings(),
+  operations(cNO_OPERATIONS),
+  short_name(),
+  demangled_rtti_name()
+{}
+
+tType::tInfo::~tInfo()
 {
-  for (size_t i = 0; i < cMAX_ANNOTATIONS; i++)
+  tAnnotations* current_annotations = annotations.load(std::memory_order_acquire);
+  if (current_annotations)
   {
-    annotations[i] = NULL;
+    for (size_t i = 0; i < current_annotations->size; i++)
+    {
+      delete current_annotations->entries[i].load(std::memory_order_relaxed);
+    }
+    delete current_annotations;
   }
 }
 
-tType::tInfo::~tInfo()
+tType::tAnnotations::tAnnotations(size_t size, tAnnotations* previous) :
+  size(size),
+  entries(new std::atomic<tTypeAnnotation*>[size]),
+  previous(previous)
 {
-  for (size_t i = 0; i < cMAX_ANNOTATIONS; i++)
+  for (size_t i = 0; i < size; i++)
   {
-    delete annotations[i];
+    entries[i].store(previous && i < previous->size ? previous->entries[i].load(std::memory_order_relaxed) : NULL, std::memory_order_relaxed);
   }
 }
 
-void tType::tInfo::DeepCopy(const void* src, void* dest, tFactory* f) const
+tType::tAnnotations::~tAnnotations()
 {
-  RRLIB_LOG_PRINT(ERROR, "Not implemented for this type");
+  delete[] entries;
+  delete previous;
+}
+
+const std::string& tType::tInfo::GetDemangledRttiName() const
+{
+  std::call_once(demangled_rtti_name_initialized, [this]()
+  {
+    demangled_rtti_name = tInternedName(internal::GetDemangledName(rtti_name));
+  });
+  return demangled_rtti_name.GetString();
+}
+
+tInternedName tType::tInfo::GetShortName() const
+{
+  std::call_once(short_name_initialized, [this]()
+  {
+    short_name = tInternedName(RemoveNamespaces(name));
+  });
+  return short_name;
 }
 
 void tType::Deserialize(serialization::tInputStream& is, void* obj) const
@@ -504,7 +1476,7 @@ void tType::Deserialize(serialization::tInputStream& is, void* obj) const
   {
     return;
   }
-  info->Deserialize(is, obj);
+  info->operations.deserialize(is, obj);
 }
 
 void tType::Serialize(serialization::tOutputStream& os, const void* obj) const
@@ -513,17 +1485,7 @@ void tType::Serialize(serialization::tOutputStream& os, const void* obj) const
   {
     return;
   }
-  info->Serialize(os, obj);
-}
-
-void tType::tInfo::Deserialize(serialization::tInputStream& is, void* obj) const
-{
-  RRLIB_LOG_PRINT(ERROR, "Not implemented for this type");
-}
-
-void tType::tInfo::Serialize(serialization::tOutputStream& os, const void* obj) const
-{
-  RRLIB_LOG_PRINT(ERROR, "Not implemented for this type");
+  info->operations.serialize(os, obj);
 }
 
 
@@ -52,10 +52,14 @@
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
 #include "rrlib/util/tNoncopyable.h"
+#include <atomic>
+#include <mutex>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
+#include "rrlib/rtti/tInternedName.h"
+#include "rrlib/rtti/tSpan.h"
 
 //----------------------------------------------------------------------
 // Namespace declaration
@@ -79,6 +83,9 @@ namespace rtti
 class tTypeAnnotation;
 class tGenericObject;
 class tFactory;
+class tGenericArray;
+class tGenericObjectArena;
+class tTypeSet;
 
 //----------------------------------------------------------------------
 // Class declaration
@@ -98,6 +105,10 @@ class tFactory;
  * One such object needs be created before a type T can be
  * deserialized/looked up etc. generically.
  *
+ * Frequently needed information on all types is additionally stored in
+ * dense tables (index is uid) - so that tools enumerating all types can
+ * scan contiguous memory (see e.g. GetSizeTable()).
+ *
  * tType is passed by value
  */
 class tType
@@ -105,20 +116,90 @@ class tType
 protected:
   struct tInfo;
 
-  /*! Maximum number of annotations per type */
-  enum { cMAX_ANNOTATIONS = 10 };
-
 //----------------------------------------------------------------------
 // Public methods and typedefs
 //----------------------------------------------------------------------
 public:
 
+  /*! Maximum number of types (limited by 16 bit uids) */
+  enum { cMAX_TYPES = 32768 };
+
   /*! Classifies wrapped type */
   enum class tClassification
   {
     PLAIN, LIST, PTR_LIST, NULL_TYPE, OTHER, UNKNOWN
   };
 
+  /*!
+   * Table with the generic operations of a data type (one function pointer per operation).
+   * Function pointers are never NULL: types without implementation use functions that print an error.
+   * Code processing many objects of the same type may obtain the table once (see GetOperations())
+   * and call the functions directly - avoiding the lookups of tType's methods.
+   */
+  struct tOperations
+  {
+    /*! Constructs (default-initialized) instances in contiguous memory (placement, count) */
+    void (*construct)(void* placement, size_t count);
+
+    /*! Destructs instances in contiguous memory (data, count) */
+    void (*destruct)(void* data, size_t count);
+
+    /*! Deep copies object (source, destination, factory) */
+    void (*deep_copy)(const void* source, void* destination, tFactory* factory);
+
+    /*! Constructs instance at destination - moving contents from source (source, destination) */
+    void (*move_construct)(void* source, void* destination);
+
+    /*! Compares two objects (object1, object2) */
+    bool (*equals)(const void* object1, const void* object2);
+
+    /*! Serializes object to binary stream (stream, object) */
+    void (*serialize)(serialization::tOutputStream& stream, const void* object);
+
+    /*! Deserializes object from binary stream (stream, object) */
+    void (*deserialize)(serialization::tInputStream& stream, void* object);
+  };
+
+  /*!
+   * Registration batch.
+   * While an object of this class exists, the cached names that become outdated due to types renamed
+   * by the current thread are not invalidated individually. Instead, they are invalidated - and the index
+   * for lookup by names derived from rtti is updated - only once when the batch is committed
+   * (on destruction of the outermost batch object of the thread).
+   * Likewise, the automaton for substituting names of renamed types is rebuilt only once after all batches have been committed.
+   * This is useful e.g. during static initialization of a plugin loaded with dlopen().
+   * Until then, FindType() may not find template types containing a type renamed in the batch
+   * by their rtti-derived names.
+   *
+   * Batches may be nested. They do not hold the lock of the type registry:
+   * other threads may register and look up types during a batch.
+   */
+  class tRegistrationBatch : private util::tNoncopyable
+  {
+  public:
+
+    tRegistrationBatch();
+
+    ~tRegistrationBatch();
+  };
+
+  /*!
+   * Guard for using types of binaries that might be unregistered concurrently (see UnregisterBinary()).
+   * UnregisterBinary() waits until all guards that existed when types were removed from the registry are destructed.
+   * Therefore, types obtained while holding a guard (e.g. via GetType() or FindType()) may safely be used until the guard is destructed.
+   *
+   * Guards may be nested. They are cheap to create - but should not be held for long,
+   * as they delay unregistration of types.
+   */
+  class tUnregistrationGuard : private util::tNoncopyable
+  {
+  public:
+
+    tUnregistrationGuard();
+
+    ~tUnregistrationGuard();
+  };
+
   tType() : info(NULL) {}
 
   /*!
@@ -149,6 +230,34 @@ public:
     return NULL;
   }
 
+  /*!
+   * Constructs 'count' instances of data type in a single contiguous memory block
+   *
+   * \param count Number of instances
+   * \return Array containing instances (destructs them when it is cleared or destructed; empty for NULL type)
+   */
+  tGenericArray CreateArrayGeneric(size_t count) const;
+
+  /*!
+   * Constructs (default-initialized) instances of data type in contiguous memory
+   *
+   * \param placement Destination (needs to have at least size count * GetSize() and alignment GetAlignment())
+   * \param count Number of instances
+   */
+  inline void ConstructInstances(void* placement, size_t count) const
+  {
+    if (info)
+    {
+      info->operations.construct(placement, count);
+    }
+  }
+
+  /*!
+   * \param arena Arena to allocate memory for generic object from
+   * \return Instance of data type wrapped as tGenericObject (must not be deleted - as it is destructed by the arena; NULL for NULL type)
+   */
+  tGenericObject* CreateInstanceGeneric(tGenericObjectArena& arena) const;
+
   /*!
    * Deep copy objects
    *
@@ -158,6 +267,58 @@ public:
    */
   void DeepCopy(const void* source, void* destination, tFactory* factory = NULL) const;
 
+  /*!
+   * Destructs instances of data type in contiguous memory (created with ConstructInstances)
+   *
+   * \param data Pointer to first instance
+   * \param count Number of instances
+   */
+  inline void DestructInstances(void* data, size_t count) const
+  {
+    if (info)
+    {
+      info->operations.destruct(data, count);
+    }
+  }
+
+  /*!
+   * Destructs generic object created with CreateInstanceGeneric(placement, true) or EmplaceInstanceGeneric()
+   * - including its wrapped data. Memory is not freed, as it is provided by the caller (or a pool).
+   *
+   * \param object Object to destroy (may be NULL)
+   */
+  static void DestroyInstanceGeneric(tGenericObject* object);
+
+  /*!
+   * Creates instance of data type at 'data_placement' - wrapped by a generic object at 'wrapper_placement'.
+   * In contrast to CreateInstanceGeneric(placement, false), no memory is allocated.
+   * Object must be destroyed with DestroyInstanceGeneric() - which also destructs the data.
+   *
+   * \param data_placement Destination for data (needs to have at least size GetSize() and alignment GetAlignment())
+   * \param wrapper_placement Destination for generic object (needs to have at least size GetEmplacedGenericObjectSize() and alignment alignof(tGenericObject))
+   * \return Generic object wrapping data (NULL for NULL type)
+   */
+  inline tGenericObject* EmplaceInstanceGeneric(void* data_placement, void* wrapper_placement) const
+  {
+    if (info)
+    {
+      return info->EmplaceInstanceGeneric(data_placement, wrapper_placement);
+    }
+    return NULL;
+  }
+
+  /*!
+   * Compares two instances of data type
+   *
+   * \param object1 First object
+   * \param object2 Second object
+   * \return Whether objects are equal (false for NULL type)
+   */
+  inline bool Equals(const void* object1, const void* object2) const
+  {
+    return info ? info->operations.equals(object1, object2) : false;
+  }
+
   /*!
    * Lookup data type by name.
    *
@@ -165,19 +326,41 @@ public:
    * 1) if 'name' does not contain a namespace, any type with the same name including a namespace will be returned as a match
    * 2) if 'name' contains a namespace, a type with the same name but without namespace will be returned as a match
    *
+   * Lookup uses hash tables that are updated on type registration - so no type names are computed here.
+   *
    * \param name Data Type name
    * \return Data type with specified name (== NULL if it could not be found)
    */
   static tType FindType(const std::string& name);
 
+  /*!
+   * Lookup data type by fingerprint (see GetFingerprint())
+   *
+   * \param fingerprint Fingerprint
+   * \return Data type with specified fingerprint (== NULL if it could not be found)
+   */
+  static tType FindTypeByFingerprint(uint64_t fingerprint);
+
   /*!
    * Lookup data type by rtti name
    *
+   * If no type with an identical rtti name pointer is registered, the rtti name string is compared
+   * (in case a shared library carries its own copy of the rtti name).
+   *
    * \param rtti_name rtti name
    * \return Data type with specified name (== NULL if it could not be found)
    */
   static tType FindTypeByRtti(const char* rtti_name);
 
+  /*!
+   * \param as_generic_object Obtain alignment as generic object?
+   * \return alignment of data type (as returned from alignof(T) or alignof(tGenericObjectInstance<T>))
+   */
+  size_t GetAlignment(bool as_generic_object = false) const
+  {
+    return info ? (as_generic_object ? info->generic_object_alignment : info->alignment) : 0;
+  }
+
   /*!
    * Get annotation of specified class
    *
@@ -187,7 +370,16 @@ public:
   template <typename T>
   inline T* GetAnnotation() const
   {
-    return info ? static_cast<T*>(info->annotations[tAnnotationIndex<T>::index]) : NULL;
+    if (info)
+    {
+      const tAnnotations* annotations = info->annotations.load(std::memory_order_acquire);
+      size_t index = static_cast<size_t>(tAnnotationIndex<T>::index.load(std::memory_order_relaxed));
+      if (annotations && index < annotations->size)
+      {
+        return static_cast<T*>(annotations->entries[index].load(std::memory_order_acquire));
+      }
+    }
+    return NULL;
   }
 
   /*!
@@ -216,6 +408,10 @@ public:
    * (no 't' prefixes; '.' instead of '::' for namespace separation; e.g. "rrlib.distance_data.DistanceData")
    * from rtti type name.
    *
+   * Default names of non-template classes and enums are computed at compile time (see TypeName) - and added to the cache of this function.
+   * Names of all other types - including List, Set, Map and Tuple types - are computed from rtti at runtime,
+   * as they may change when types they contain are renamed.
+   *
    * \param rtti Mangled rtti type name
    * \param remove_namespaces Remove namespaces from type names? (should only be used if name collisions are not an issue or cannot occur)
    * \return (Demangled) type name in rrlib::rtti format
@@ -246,6 +442,19 @@ public:
     return info && info->non_standard_enum_value_strings.size() ? &info->non_standard_enum_value_strings : NULL;
   }
 
+  /*!
+   * \return Fingerprint of data type: 64 bit hash of its name derived from rtti (see GetFingerprint(const std::string&)).
+   * This name reflects all renamings - also of types registered later (e.g. the element type of a list type).
+   * Unlike uids, fingerprints are therefore identical in all processes - and may be used to identify types across processes.
+   */
+  uint64_t GetFingerprint() const;
+
+  /*!
+   * \param type_name Type name
+   * \return Fingerprint of data type with this name (64 bit FNV-1a hash of name)
+   */
+  static uint64_t GetFingerprint(const std::string& type_name);
+
   /*!
    * \return If this is a plain type and a list type has been initialized: list type (std::vector<T>) - otherwise NULL
    */
@@ -261,7 +470,17 @@ public:
   inline const std::string& GetName(bool without_namespace = false) const
   {
     static const std::string null_type_string = "NULL";
-    return info ? (without_namespace ? info->short_name : info->name) : null_type_string;
+    return info ? (without_namespace ? info->GetShortName().GetString() : info->name) : null_type_string;
+  }
+
+  /*!
+   * \param without_namespace Return name of data type without any namespaces?
+   * \return Interned name of data type (can be compared and hashed efficiently - e.g. when used as key in maps)
+   */
+  inline tInternedName GetInternedName(bool without_namespace = false) const
+  {
+    static const tInternedName null_type_name("NULL");
+    return info ? (without_namespace ? info->GetShortName() : info->interned_name) : null_type_name;
   }
 
   /*!
@@ -278,7 +497,7 @@ public:
   inline const std::string& GetRttiNameDemangled() const
   {
     static const std::string null_type_string = "NULL";
-    return info ? info->demangled_rtti_name : null_type_string;
+    return info ? info->GetDemangledRttiName() : null_type_string;
   }
 
   /*!
@@ -289,6 +508,14 @@ public:
     return tType(info ? info->shared_ptr_list_type : NULL);
   }
 
+  /*!
+   * \return Table with generic operations of data type (table with functions that print errors for NULL type)
+   */
+  inline const tOperations& GetOperations() const
+  {
+    return info ? info->operations : cNO_OPERATIONS;
+  }
+
   /*!
    * \param Obtain size as generic object?
    * \return size of data type (as returned from sizeof(T) or sizeof(tGenericObjectInstance<T>))
@@ -298,6 +525,14 @@ public:
     return info ? (as_generic_object ? info->generic_object_size : info->size) : 0;
   }
 
+  /*!
+   * \return size of generic object wrapping data at another address (see EmplaceInstanceGeneric())
+   */
+  size_t GetEmplacedGenericObjectSize() const
+  {
+    return info ? info->emplaced_generic_object_size : 0;
+  }
+
   /*!
    * \return returns "Type" of data type (see enum)
    */
@@ -313,10 +548,48 @@ public:
   static tType GetType(int16_t uid);
 
   /*!
-   * \return Number of registered types
+   * \return Number of uids in use (all registered types have smaller uids; GetType() returns NULL types for uids of unregistered types)
    */
   static uint16_t GetTypeCount();
 
+  /*!
+   * Tables with information on all types.
+   * Index is uid; size is GetTypeCount() at the time of the call.
+   * Entries of unused uids contain the values of the NULL type (-1 for uids).
+   * Apart from uids of related types, entries of a type do not change while it is registered (they are reset after UnregisterBinary() waited for tUnregistrationGuard objects).
+   *
+   * \return Classifications of all types (see GetType())
+   */
+  static tSpan<tClassification> GetClassificationTable();
+
+  /*!
+   * Entries are atomic as they change when related types are registered or unregistered (load with std::memory_order_relaxed).
+   *
+   * \return Uids of the element types of all types (see GetElementType(); -1 if there is none; see GetClassificationTable())
+   */
+  static tSpan<std::atomic<int16_t>> GetElementTypeUidTable();
+
+  /*!
+   * \return Uids of the list types of all types (see GetListType(); -1 if there is none; see GetElementTypeUidTable())
+   */
+  static tSpan<std::atomic<int16_t>> GetListTypeUidTable();
+
+  /*!
+   * \return Names of all types (see GetInternedName(); see GetClassificationTable())
+   */
+  static tSpan<tInternedName> GetNameTable();
+
+  /*!
+   * \param as_generic_object Sizes as generic object?
+   * \return Sizes of all types (see GetSize(); see GetClassificationTable())
+   */
+  static tSpan<size_t> GetSizeTable(bool as_generic_object = false);
+
+  /*!
+   * \return Type traits of all types (see GetTypeTraits(); see GetClassificationTable())
+   */
+  static tSpan<int> GetTypeTraitsTable();
+
   /*!
    * \return Bit vector of type traits determined at compile time (see type_traits.h)
    */
@@ -325,6 +598,23 @@ public:
     return info ? info->type_traits : 0;
   }
 
+  /*!
+   * Lookup of types by traits.
+   * The registry maintains a bit vector for each trait - so no types need to be inspected.
+   *
+   * \param traits Bit vector of traits (see trait_flags in type_traits.h)
+   * \return Set of all registered types that have all of the specified traits (all registered types if 'traits' is zero)
+   */
+  static tTypeSet GetTypesWithAllTraits(int traits);
+
+  /*!
+   * Lookup of types by traits (see GetTypesWithAllTraits())
+   *
+   * \param traits Bit vector of traits (see trait_flags in type_traits.h)
+   * \return Set of all registered types that have any of the specified traits
+   */
+  static tTypeSet GetTypesWithAnyTrait(int traits);
+
   /*!
    * \return uid of data type
    */
@@ -345,6 +635,39 @@ public:
     return data_type == *this;
   }
 
+  /*!
+   * Constructs instance of data type at destination - moving contents from source
+   * (types without move constructor are default-constructed and deep-copied).
+   * Source object remains valid (with unspecified contents) and needs to be destructed.
+   *
+   * \param source Source object
+   * \param destination Destination (needs to have at least size GetSize() and alignment GetAlignment())
+   */
+  inline void MoveConstruct(void* source, void* destination) const
+  {
+    if (info)
+    {
+      info->operations.move_construct(source, destination);
+    }
+  }
+
+  /*!
+   * Unregisters all types that were registered during static initialization of the specified binary.
+   * Must be called before a shared library is unloaded (e.g. using dlclose()).
+   * Afterwards, no tType objects referring to the removed types may be used anymore.
+   * Types of other binaries no longer refer to removed types (e.g. as list type).
+   * Uids of removed types are reused for types registered later.
+   *
+   * Waits until concurrent users of types have destructed their tUnregistrationGuard objects.
+   * Must not be called while the current thread holds such a guard.
+   * Other threads may look up and register types while this function waits.
+   * Annotations that the binary added to types of other binaries are not removed.
+   *
+   * \param binary Binary file (see GetBinary() - with or without path)
+   * \return Number of unregistered types
+   */
+  static size_t UnregisterBinary(const std::string& binary);
+
   /*!
    * for checks against NULL (if (type == NULL) {...} )
    */
@@ -394,30 +717,57 @@ public:
 //----------------------------------------------------------------------
 protected:
 
+  /*!
+   * Annotations of a type (index is annotation index - see tAnnotationIndex).
+   * When an annotation with an index beyond 'size' is added, a larger array is created and published atomically.
+   * Replaced arrays are kept (readers might still access them) - and are deleted together with the type info.
+   */
+  struct tAnnotations : private util::tNoncopyable
+  {
+    /*! Number of entries */
+    const size_t size;
+
+    /*! Annotations */
+    std::atomic<tTypeAnnotation*>* const entries;
+
+    /*! Replaced array with fewer entries (or NULL) */
+    tAnnotations* const previous;
+
+    tAnnotations(size_t size, tAnnotations* previous);
+
+    ~tAnnotations();
+  };
+
   /*! Generic data type information */
   struct tInfo : private util::tNoncopyable
   {
     /*! Type of data type */
     const tType::tClassification type;
 
-    /*! Name of data type */
-    const std::string name;
+    /*! Name of data type (interned) */
+    const tInternedName interned_name;
 
-    /*! Short name of data type */
-    const std::string short_name;
+    /*! Name of data type (refers to string of interned_name) */
+    const std::string& name;
 
     /*! RTTI name */
     const char* rtti_name;
 
-    /*! Demangled RTTI name */
-    const std::string demangled_rtti_name;
-
     /*! sizeof(T) */
     size_t size;
 
     /*! sizeof(tGenericObjectInstance<T>) */
     size_t generic_object_size;
 
+    /*! alignof(T) */
+    size_t alignment;
+
+    /*! alignof(tGenericObjectInstance<T>) */
+    size_t generic_object_alignment;
+
+    /*! sizeof(detail::tGenericObjectInstanceEmplaced<T>) */
+    size_t emplaced_generic_object_size;
+
     /*! Bit vector of type traits determined at compile time (see tTypeTraitVector) */
     int type_traits;
 
@@ -436,8 +786,8 @@ protected:
     /*! In case of element: shared pointer list type (std::vector<std::shared_ptr<T>>) */
     tInfo* shared_ptr_list_type;
 
-    /*! Annotations to data type */
-    tTypeAnnotation* annotations[cMAX_ANNOTATIONS];
+    /*! Annotations to data type (NULL if no annotations have been added) */
+    std::atomic<tAnnotations*> annotations;
 
     /*! binary file that initializes data type statically (includes path) */
     std::string binary;
@@ -448,11 +798,24 @@ protected:
     /*! Strings of enum values - if they are custom (non-standard) */
     std::vector<std::string> non_standard_enum_value_strings;
 
+    /*! Generic operations of data type (set by subclass - functions printing errors by default) */
+    tOperations operations;
+
 
     tInfo(tType::tClassification classification, const char* rtti_name, const std::string& name);
 
     virtual ~tInfo();
 
+    /*!
+     * \return Demangled RTTI name (computed on first call)
+     */
+    const std::string& GetDemangledRttiName() const;
+
+    /*!
+     * \return Short name of data type (computed on first call)
+     */
+    tInternedName GetShortName() const;
+
     /*!
      * \param placement (Optional) Destination for placement new
      * \param emplace_generic_object If placement is specified: place generic objects at this memory address (true) or only data (false)?
@@ -464,32 +827,27 @@ protected:
     }
 
     /*!
-     * Deep copy objects
-     *
-     * \param src Src object
-     * \param dest Destination object
-     * \param f Factory to use
+     * \param data_placement Destination for data
+     * \param wrapper_placement Destination for generic object
+     * \return Generic object wrapping data (destructs data when it is destructed)
      */
-    virtual void DeepCopy(const void* src, void* dest, tFactory* f) const;
+    virtual tGenericObject* EmplaceInstanceGeneric(void*, void*) const
+    {
+      return NULL;
+    }
 
     virtual void Init() {}
 
-    /*!
-     * Deserialize object from input stream
-     *
-     * \param os InputStream
-     * \param obj Object to deserialize
-     */
-    virtual void Deserialize(serialization::tInputStream& is, void* obj) const;
+  private:
 
     /*!
-     * Serialize object to output stream
-     *
-     * \param os OutputStream
-     * \param obj Object to serialize
+     * Short name and demangled RTTI name of data type.
+     * They are not needed for most types - and are therefore computed on first use
+     * (instead of for every type during static initialization).
+     * They are interned, as they are often equal to the name of this or another type.
      */
-    virtual void Serialize(serialization::tOutputStream& os, const void* obj) const;
-
+    mutable tInternedName short_name, demangled_rtti_name;
+    mutable std::once_flag short_name_initialized, demangled_rtti_name_initialized;
   };
 
   tType(tInfo* info);
@@ -502,17 +860,20 @@ private:
   /*! Pointer to data type info (should not be copied every time for efficiency reasons) */
   const tInfo* info;
 
+  /*! Operations of NULL type and types without implementation (functions print errors) */
+  static const tOperations cNO_OPERATIONS;
+
   /*! Helper struct for annotating types */
   template <typename T>
   struct tAnnotationIndex
   {
-    static int index;
+    static std::atomic<int> index;
   };
 
   /*!
    * Implementation of AddAnnotation function
    */
-  void AddAnnotationImplementation(tTypeAnnotation* annotation, bool (*annotation_index_valid_function)(bool), int& annotation_index);
+  void AddAnnotationImplementation(tTypeAnnotation* annotation, bool (*annotation_index_valid_function)(bool), std::atomic<int>& annotation_index);
 
   /*! Has specified type T a valid annotation index? */
   template <typename T>
@@ -533,10 +894,26 @@ private:
    */
   static std::string RemoveNamespaces(const std::string& type_name);
 
+  /*!
+   * Updates entries of registered type in tables with information on all types (see GetClassificationTable())
+   * (registry mutex must be locked)
+   *
+   * \param info Info of registered type
+   */
+  static void UpdateTables(const tInfo& info);
+
+  /*!
+   * Updates entries of registered type in tables that refer to related types (element and list type)
+   * (registry mutex must be locked)
+   *
+   * \param info Info of registered type
+   */
+  static void UpdateRelatedTypeTables(const tInfo& info);
+
 };
 
 template <typename T>
-int tType::tAnnotationIndex<T>::index;
+std::atomic<int> tType::tAnnotationIndex<T>::index;
 
 serialization::tOutputStream& operator << (serialization::tOutputStream& stream, const tType& dt);
 serialization::tInputStream& operator >> (serialization::tInputStream& stream, tType& dt);
@@ -0,0 +1,179 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti/tTypeSet.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/rtti/tTypeSet.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+void tTypeSet::Add(const tType& type)
+{
+  if (type == NULL)
+  {
+    return;
+  }
+  size_t uid = static_cast<size_t>(type.GetUid());
+  if (words.size() <= uid / cBITS_PER_WORD)
+  {
+    words.resize(uid / cBITS_PER_WORD + 1, 0);
+  }
+  words[uid / cBITS_PER_WORD] |= static_cast<uint64_t>(1) << (uid % cBITS_PER_WORD);
+}
+
+bool tTypeSet::Contains(const tType& type) const
+{
+  if (type == NULL)
+  {
+    return false;
+  }
+  size_t uid = static_cast<size_t>(type.GetUid());
+  return uid / cBITS_PER_WORD < words.size() && (words[uid / cBITS_PER_WORD] & (static_cast<uint64_t>(1) << (uid % cBITS_PER_WORD)));
+}
+
+size_t tTypeSet::Count() const
+{
+  size_t count = 0;
+  for (uint64_t word : words)
+  {
+#ifdef __GNUC__
+    count += static_cast<size_t>(__builtin_popcountll(word));
+#else
+    for (; word; word &= word - 1)
+    {
+      count++;
+    }
+#endif
+  }
+  return count;
+}
+
+bool tTypeSet::Empty() const
+{
+  return std::all_of(words.begin(), words.end(), [](uint64_t word)
+  {
+    return word == 0;
+  });
+}
+
+void tTypeSet::Remove(const tType& type)
+{
+  if (Contains(type))
+  {
+    size_t uid = static_cast<size_t>(type.GetUid());
+    words[uid / cBITS_PER_WORD] &= ~(static_cast<uint64_t>(1) << (uid % cBITS_PER_WORD));
+  }
+}
+
+std::vector<tType> tTypeSet::ToVector() const
+{
+  std::vector<tType> result;
+  ForEach([&result](const tType & type)
+  {
+    result.push_back(type);
+  });
+  return result;
+}
+
+tTypeSet& tTypeSet::operator&=(const tTypeSet& other)
+{
+  if (words.size() > other.words.size())
+  {
+    words.resize(other.words.size());
+  }
+  for (size_t i = 0; i < words.size(); i++)
+  {
+    words[i] &= other.words[i];
+  }
+  return *this;
+}
+
+tTypeSet& tTypeSet::operator|=(const tTypeSet& other)
+{
+  if (words.size() < other.words.size())
+  {
+    words.resize(other.words.size(), 0);
+  }
+  for (size_t i = 0; i < other.words.size(); i++)
+  {
+    words[i] |= other.words[i];
+  }
+  return *this;
+}
+
+bool tTypeSet::operator==(const tTypeSet& other) const
+{
+  size_t common_size = std::min(words.size(), other.words.size());
+  const std::vector<uint64_t>& longer = words.size() > other.words.size() ? words : other.words;
+  return std::equal(words.begin(), words.begin() + common_size, other.words.begin()) &&
+         std::all_of(longer.begin() + common_size, longer.end(), [](uint64_t word)
+  {
+    return word == 0;
+  });
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
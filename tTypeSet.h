@@ -0,0 +1,206 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti/tTypeSet.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tTypeSet
+ *
+ * \b tTypeSet
+ *
+ * Set of registered types - stored as bit vector indexed by uid.
+ * Sets can be combined efficiently with AND/OR operations.
+ * Sets of types with certain traits are obtained from tType::GetTypesWithAllTraits()
+ * and tType::GetTypesWithAnyTrait().
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__rtti__tTypeSet_h__
+#define __rrlib__rtti__tTypeSet_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstdint>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/rtti/tType.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Set of types
+/*!
+ * Set of registered types - stored as bit vector indexed by uid.
+ * Sets can be combined efficiently with AND/OR operations.
+ * Sets of types with certain traits are obtained from tType::GetTypesWithAllTraits()
+ * and tType::GetTypesWithAnyTrait().
+ */
+class tTypeSet
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Creates empty set */
+  tTypeSet() : words()
+  {}
+
+  /*!
+   * \param type Type to add (NULL type is ignored)
+   */
+  void Add(const tType& type);
+
+  /*!
+   * \param type Type
+   * \return Whether set contains type
+   */
+  bool Contains(const tType& type) const;
+
+  /*!
+   * \return Number of types in set
+   */
+  size_t Count() const;
+
+  /*!
+   * \return Whether set contains no types
+   */
+  bool Empty() const;
+
+  /*!
+   * Calls function for each type in set (in order of uids).
+   * Types that have been unregistered in the meantime are skipped.
+   *
+   * \param function Function to call (with tType as argument)
+   */
+  template <typename TFunction>
+  void ForEach(TFunction function) const
+  {
+    for (size_t i = 0; i < words.size(); i++)
+    {
+      for (uint64_t word = words[i]; word; word &= word - 1)
+      {
+        tType type = tType::GetType(static_cast<int16_t>(i * cBITS_PER_WORD + LowestBitIndex(word)));
+        if (type != NULL)
+        {
+          function(type);
+        }
+      }
+    }
+  }
+
+  /*!
+   * \param type Type to remove
+   */
+  void Remove(const tType& type);
+
+  /*!
+   * \return Types in set (in order of uids)
+   */
+  std::vector<tType> ToVector() const;
+
+  /*! Intersection */
+  tTypeSet& operator&=(const tTypeSet& other);
+
+  /*! Union */
+  tTypeSet& operator|=(const tTypeSet& other);
+
+  tTypeSet operator&(const tTypeSet& other) const
+  {
+    tTypeSet result(*this);
+    result &= other;
+    return result;
+  }
+
+  tTypeSet operator|(const tTypeSet& other) const
+  {
+    tTypeSet result(*this);
+    result |= other;
+    return result;
+  }
+
+  bool operator==(const tTypeSet& other) const;
+
+  bool operator!=(const tTypeSet& other) const
+  {
+    return !(*this == other);
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  friend class tType;
+
+  enum { cBITS_PER_WORD = 64 };
+
+  /*! Bit vector (bit i of word w is set if type with uid w * 64 + i is in set; trailing words may be omitted) */
+  std::vector<uint64_t> words;
+
+  /*!
+   * \param word Word (must not be zero)
+   * \return Index of lowest bit set in word
+   */
+  static inline size_t LowestBitIndex(uint64_t word)
+  {
+#ifdef __GNUC__
+    return static_cast<size_t>(__builtin_ctzll(word));
+#else
+    size_t index = 0;
+    while (!(word & 1))
+    {
+      word >>= 1;
+      index++;
+    }
+    return index;
+#endif
+  }
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
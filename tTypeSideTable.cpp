@@ -0,0 +1,120 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti/tTypeSideTable.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/rtti/tTypeSideTable.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace detail
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+/*!
+ * All existing side tables.
+ * As side tables may be static objects that are destructed during static deinitialization, this is never deleted.
+ */
+struct tSideTables
+{
+  std::mutex mutex;
+  std::vector<tTypeSideTableBase*> tables;
+};
+
+static tSideTables& GetSideTables()
+{
+  static tSideTables* side_tables = new tSideTables();
+  return *side_tables;
+}
+
+tTypeSideTableBase::tTypeSideTableBase()
+{
+  tSideTables& side_tables = GetSideTables();
+  std::unique_lock<std::mutex> lock(side_tables.mutex);
+  side_tables.tables.push_back(this);
+}
+
+tTypeSideTableBase::~tTypeSideTableBase()
+{
+  tSideTables& side_tables = GetSideTables();
+  std::unique_lock<std::mutex> lock(side_tables.mutex);
+  side_tables.tables.erase(std::remove(side_tables.tables.begin(), side_tables.tables.end(), this), side_tables.tables.end());
+}
+
+void tTypeSideTableBase::ResetEntries(const std::vector<int16_t>& uids)
+{
+  tSideTables& side_tables = GetSideTables();
+  std::unique_lock<std::mutex> lock(side_tables.mutex);
+  for (tTypeSideTableBase* table : side_tables.tables)
+  {
+    for (int16_t uid : uids)
+    {
+      table->ResetEntry(uid);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
@@ -0,0 +1,203 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti/tTypeSideTable.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tTypeSideTable
+ *
+ * \b tTypeSideTable
+ *
+ * Table that stores a value for each type (index is uid).
+ * For attaching data to types, this is a more efficient alternative to type annotations:
+ * lookup is a single indexed (atomic) load - with no virtual base classes or casts involved.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__rtti__tTypeSideTable_h__
+#define __rrlib__rtti__tTypeSideTable_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <atomic>
+#include <cassert>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/rtti/tType.h"
+#include "rrlib/rtti/detail/tSegmentedArray.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+namespace detail
+{
+
+/*!
+ * Base class of all side tables.
+ * Existing side tables are tracked, so that entries of unregistered types
+ * can be reset before their uids are reused (see tType::UnregisterBinary()).
+ */
+class tTypeSideTableBase : private util::tNoncopyable
+{
+public:
+
+  tTypeSideTableBase();
+
+  virtual ~tTypeSideTableBase();
+
+  /*!
+   * Resets entries in all side tables
+   *
+   * \param uids Uids of entries to reset
+   */
+  static void ResetEntries(const std::vector<int16_t>& uids);
+
+private:
+
+  /*!
+   * Resets entry to default value
+   *
+   * \param uid Uid of entry
+   */
+  virtual void ResetEntry(int16_t uid) = 0;
+};
+
+}
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Per-type side table
+/*!
+ * Table that stores a value for each type (index is uid).
+ * For attaching data to types, this is a more efficient alternative to type annotations:
+ * lookup is a single indexed (atomic) load - with no virtual base classes or casts involved.
+ *
+ * The table grows automatically in segments (that are never moved) as values for types with higher uids are set.
+ * Values may be read concurrently to setting them.
+ * When types are unregistered, their values are reset to the default value (after tType::UnregisterBinary() waited for tUnregistrationGuard objects).
+ *
+ * \tparam T Value type (must be trivially copyable - e.g. a pointer or a small struct; default value is T())
+ */
+template <typename T>
+class tTypeSideTable : public detail::tTypeSideTableBase
+{
+  static_assert(std::is_trivially_copyable<T>::value, "Values in side tables are stored atomically and must therefore be trivially copyable");
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  tTypeSideTable() : entries()
+  {}
+
+  /*!
+   * (may be called concurrently to Set())
+   *
+   * \param type Type
+   * \return Value for type (default value if no value has been set)
+   */
+  inline T Get(const tType& type) const
+  {
+    const std::atomic<T>* entry = entries.Find(static_cast<size_t>(type.GetUid()));
+    return entry ? entry->load(std::memory_order_acquire) : T();
+  }
+
+  /*!
+   * \param type Type (must not be the NULL type)
+   * \param value Value to set for type
+   */
+  void Set(const tType& type, const T& value)
+  {
+    assert(type != NULL);
+    std::unique_lock<std::mutex> lock(mutex);
+    entries.GetOrCreate(static_cast<size_t>(type.GetUid())).store(value, std::memory_order_release);
+  }
+
+  inline T operator[](const tType& type) const
+  {
+    return Get(type);
+  }
+
+//----------------------------------------------------------------------
+// Protected methods
+//----------------------------------------------------------------------
+protected:
+
+  /*!
+   * Called after the entry of an unregistered type has been reset.
+   * May be overridden to release resources that values refer to.
+   *
+   * \param value Value of entry before it was reset
+   */
+  virtual void OnEntryReset(const T&)
+  {}
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  enum { cSEGMENT_SIZE = 256 };
+
+  /*! Values (index is uid) */
+  detail::tSegmentedArray<std::atomic<T>, cSEGMENT_SIZE, tType::cMAX_TYPES> entries;
+
+  /*! Synchronizes writers */
+  std::mutex mutex;
+
+  virtual void ResetEntry(int16_t uid) override
+  {
+    std::atomic<T>* entry = entries.Find(static_cast<size_t>(uid));
+    if (entry)
+    {
+      OnEntryReset(entry->exchange(T(), std::memory_order_acq_rel));
+    }
+  }
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
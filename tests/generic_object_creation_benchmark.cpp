@@ -0,0 +1,167 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/rtti/tests/generic_object_creation_benchmark.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * Measures the time tType::CreateInstanceGeneric takes to construct large
+ * buffer types - with and without zero-filling memory (see RequiresZeroFill).
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/rtti/rtti.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace rtti
+{
+namespace benchmark
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+/*! Number of bytes (approximately) constructed per buffer type and measurement */
+const size_t cBYTES_PER_MEASUREMENT = 256 * 1024 * 1024;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+/*!
+ * Image buffer with uninitialized pixels (like buffers that are filled by e.g. a camera driver)
+ */
+template <size_t SIZE>
+struct tImageBuffer
+{
+  tImageBuffer() : width(0), height(0)
+  {}
+
+  bool operator==(const tImageBuffer& other) const
+  {
+    return width == other.width && height == other.height && memcmp(pixels, other.pixels, width * height) == 0;
+  }
+
+  uint32_t width, height;
+  uint8_t pixels[SIZE];
+};
+
+/*! Identical buffer type - except that it is zero-filled */
+template <size_t SIZE>
+struct tZeroFilledImageBuffer : tImageBuffer<SIZE>
+{};
+
+}
+
+template <size_t SIZE>
+struct RequiresZeroFill<benchmark::tZeroFilledImageBuffer<SIZE>>
+{
+  enum { value = true };
+};
+
+namespace benchmark
+{
+
+static_assert(!RequiresZeroFill<tImageBuffer<16>>::value, "Image buffers should not be zero-filled");
+
+/*!
+ * \return Average duration of creating and destroying an instance of type in ns
+ */
+double MeasureCreation(tType type, void* memory)
+{
+  size_t iterations = std::max<size_t>(10000, cBYTES_PER_MEASUREMENT / type.GetSize());
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < iterations; i++)
+  {
+    tType::DestroyInstanceGeneric(type.CreateInstanceGeneric(memory, true));
+  }
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / iterations;
+}
+
+template <size_t SIZE>
+void RunBenchmark()
+{
+  tType plain_type = tDataType<tImageBuffer<SIZE>>("ImageBuffer" + std::to_string(SIZE));
+  tType zero_filled_type = tDataType<tZeroFilledImageBuffer<SIZE>>("ZeroFilledImageBuffer" + std::to_string(SIZE));
+  assert(plain_type.GetSize(true) == zero_filled_type.GetSize(true));
+  void* memory = operator new(plain_type.GetSize(true));
+
+  MeasureCreation(zero_filled_type, memory);  // warm up
+  double zero_filled = MeasureCreation(zero_filled_type, memory);
+  double plain = MeasureCreation(plain_type, memory);
+  std::cout << SIZE << " byte buffer: " << zero_filled << " ns with zero-fill, " << plain << " ns without (" << (zero_filled - plain) << " ns saved)" << std::endl;
+  operator delete(memory);
+}
+
+int Main()
+{
+  std::cout << "Average duration of CreateInstanceGeneric + DestroyInstanceGeneric:" << std::endl;
+  RunBenchmark<64>();
+  RunBenchmark<4096>();
+  RunBenchmark<65536>();
+  RunBenchmark<1048576>();
+  return EXIT_SUCCESS;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+int main()
+{
+  return rrlib::rtti::benchmark::Main();
+}
@@ -34,12 +34,25 @@
 //----------------------------------------------------------------------
 #include "rrlib/util/tUnitTestSuite.h"
 #include "rrlib/util/string.h"
+#include "rrlib/util/demangle.h"
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <dlfcn.h>
 #include <thread>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "rrlib/rtti/rtti.h"
+#include "rrlib/rtti/registration_profiling.h"
+#include "rrlib/rtti/tFingerprintTypeEncoder.h"
+#include "rrlib/rtti/tGenericArray.h"
+#include "rrlib/rtti/tGenericObjectArena.h"
+#include "rrlib/rtti/tGenericObjectPool.h"
+#include "rrlib/rtti/tGenericValue.h"
+#include "rrlib/rtti/tTypeAnnotation.h"
+#include "rrlib/rtti/tTypeSideTable.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -78,12 +91,71 @@ class Class2 {};
 class RenamedClass {};
 class TypeTraitRenamedClass {};
 class ClassInitializedInThread {};
+class LateRenamedClass {};
+class BatchRenamedClass {};
+class AnnotatedClass {};
+class UnregistrationTestClass {};
+class UnregistrationRenamedClass {};
+class StaticallyRegisteredClass {};
+struct DestructorCountingClass
+{
+  ~DestructorCountingClass()
+  {
+    destructor_calls++;
+  }
+  bool operator==(const DestructorCountingClass&) const
+  {
+    return true;
+  }
+  static int destructor_calls;
+};
+int DestructorCountingClass::destructor_calls = 0;
+struct LargeClass
+{
+  double values[8];
+};
+struct NonMovableClass
+{
+  NonMovableClass() : value(0)
+  {}
+  NonMovableClass(NonMovableClass&&) = delete;
+  void CopyFrom(const NonMovableClass& other)
+  {
+    value = other.value;
+  }
+  bool operator==(const NonMovableClass& other) const
+  {
+    return value == other.value;
+  }
+  int value;
+};
+class tPrefixedClass
+{
+public:
+  class tNestedClass {};
+  enum class tEnum { A, B };
+};
 
 template <typename T>
 class TemplateClass {};
 
+template <int N>
+class tTestAnnotation : public tTypeAnnotation {};
+
+static_assert(RequiresZeroFill<Class1>::value && (!RequiresZeroFill<std::string>::value) && (!RequiresZeroFill<double>::value), "Trait not implemented correctly");
+
+static tDataType<StaticallyRegisteredClass> cSTATICALLY_REGISTERED_TYPE;
+
 } // namespace test
 
+template<>
+struct AutoRegisterRelatedTypes<test::NonMovableClass> // std::vector<NonMovableClass> cannot be instantiated
+{
+  static void Register()
+  {
+  }
+};
+
 template<>
 struct TypeName<test::TypeTraitRenamedClass>
 {
@@ -93,6 +165,33 @@ struct TypeName<test::TypeTraitRenamedClass>
   }
 };
 
+template<>
+struct TypeName<test::LateRenamedClass>
+{
+  static std::string Get()
+  {
+    return "Late Name";
+  }
+};
+
+template<>
+struct TypeName<test::BatchRenamedClass>
+{
+  static std::string Get()
+  {
+    return "Batch Name";
+  }
+};
+
+template<>
+struct TypeName<test::UnregistrationRenamedClass>
+{
+  static std::string Get()
+  {
+    return "Unregistration Name";
+  }
+};
+
 namespace test
 {
 
@@ -103,6 +202,25 @@ class tTestTraitsRtti : public util::tUnitTestSuite
   RRLIB_UNIT_TESTS_ADD_TEST(TestGetBinary);
   RRLIB_UNIT_TESTS_ADD_TEST(TestGenericOperations);
   RRLIB_UNIT_TESTS_ADD_TEST(TestDataTypeInstantiation);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestFindType);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestCompileTimeTypeNames);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestInternedNames);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestRegistrationBatch);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestUnregisterBinary);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestUnregisterLoadedBinary);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestTypeTables);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestTypeSets);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestAnnotations);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestSideTable);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestGenericObjectPool);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestGenericObjectArena);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestEmplacedGenericObject);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestGenericArray);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestGenericValue);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestOperationTable);
+#if RRLIB_RTTI_REGISTRATION_PROFILING_ENABLED
+  RRLIB_UNIT_TESTS_ADD_TEST(TestRegistrationProfiles);
+#endif
   RRLIB_UNIT_TESTS_END_SUITE;
 
 private:
@@ -216,6 +334,420 @@ private:
     RRLIB_UNIT_TESTS_ASSERT(ulong_type == ulong_vector_type.GetElementType());
   }
 
+  void TestFindType()
+  {
+    tDataType<std::vector<LateRenamedClass>> type_list; // list type is registered before element type is renamed
+    tDataType<LateRenamedClass> type;
+    RRLIB_UNIT_TESTS_ASSERT(tType::FindType("Late Name") == type);
+    RRLIB_UNIT_TESTS_ASSERT(tType::FindType("rrlib.rtti.test.LateRenamedClass") == type);
+    RRLIB_UNIT_TESTS_ASSERT(tType::FindType(type_list.GetName()) == type_list);
+    RRLIB_UNIT_TESTS_ASSERT(tType::FindType("List<Late Name>") == type_list);
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("List<Late Name>"), tType::GetTypeNameFromRtti(typeid(std::vector<LateRenamedClass>).name()));
+    RRLIB_UNIT_TESTS_ASSERT(tType::FindType("other.name_space.Class1") == tDataType<Class1>());
+    RRLIB_UNIT_TESTS_ASSERT(tType::FindType("Class1") == tDataType<Class1>());
+    RRLIB_UNIT_TESTS_ASSERT(tType::FindType("NULL") == tType());
+    RRLIB_UNIT_TESTS_ASSERT(tType::FindType("rrlib.rtti.test.NotRegistered") == tType());
+
+    std::string rtti_name_copy = typeid(LateRenamedClass).name();
+    RRLIB_UNIT_TESTS_ASSERT(tType::FindTypeByRtti(typeid(LateRenamedClass).name()) == type);
+    RRLIB_UNIT_TESTS_ASSERT(tType::FindTypeByRtti(rtti_name_copy.c_str()) == type);
+    RRLIB_UNIT_TESTS_ASSERT(tDataType<Class1>::FindTypeByRtti(rtti_name_copy.c_str()) == type);
+
+    RRLIB_UNIT_TESTS_EQUALITY(tType::GetFingerprint("Late Name"), type.GetFingerprint());
+    RRLIB_UNIT_TESTS_ASSERT(tType::FindTypeByFingerprint(type.GetFingerprint()) == type);
+    RRLIB_UNIT_TESTS_ASSERT(tType::FindTypeByFingerprint(tType::GetFingerprint("rrlib.rtti.test.NotRegistered")) == tType());
+    RRLIB_UNIT_TESTS_EQUALITY(tType::GetFingerprint("List<Late Name>"), type_list.GetFingerprint()); // same as in processes registering element type first
+    RRLIB_UNIT_TESTS_ASSERT(tType::FindTypeByFingerprint(tType::GetFingerprint("List<Late Name>")) == type_list);
+    serialization::tMemoryBuffer buffer;
+    tFingerprintTypeEncoder encoder;
+    {
+      serialization::tOutputStream stream(buffer, encoder);
+      stream << type_list << tType();
+      stream.Close();
+    }
+    serialization::tInputStream stream(buffer, encoder);
+    tType read_type_list, read_null_type = type_list;
+    stream >> read_type_list >> read_null_type;
+    RRLIB_UNIT_TESTS_ASSERT(read_type_list == type_list);
+    RRLIB_UNIT_TESTS_ASSERT(read_null_type == tType());
+  }
+
+  /*!
+   * \param demangled Demangled name of a non-template type
+   * \return Name in rrlib_rtti format (computed independently of tType::GetTypeNameFromRtti() and its cache)
+   */
+  static std::string NormalizeDemangledName(const std::string& demangled)
+  {
+    std::string result;
+    bool word_start = true;
+    for (size_t i = 0; i < demangled.length(); i++)
+    {
+      if (demangled.compare(i, 2, "::") == 0)
+      {
+        result += '.';
+        i++;
+        word_start = true;
+        continue;
+      }
+      if (word_start && demangled[i] == 't' && i + 1 < demangled.length() && isupper(demangled[i + 1]))
+      {
+        i++;
+      }
+      result += demangled[i];
+      word_start = !isalnum(demangled[i]);
+    }
+    return result;
+  }
+
+  template <typename T>
+  void TestCompileTimeTypeName(bool available)
+  {
+    typedef rrlib::rtti::detail::tCompileTimeTypeName<T> tCompileTimeName;
+    RRLIB_UNIT_TESTS_EQUALITY(available, tCompileTimeName::cAVAILABLE);
+    if (tCompileTimeName::cAVAILABLE)
+    {
+      RRLIB_UNIT_TESTS_EQUALITY(util::Demangle(typeid(T).name()), std::string(tCompileTimeName::GetDemangled(), tCompileTimeName::End() - tCompileTimeName::Begin()));
+      RRLIB_UNIT_TESTS_EQUALITY(NormalizeDemangledName(util::Demangle(typeid(T).name())), std::string(tCompileTimeName::Get()));
+    }
+  }
+
+  void TestCompileTimeTypeNames()
+  {
+#ifdef __GNUC__
+    static_assert(rrlib::rtti::detail::tCompileTimeTypeName<tPrefixedClass::tNestedClass>::cLENGTH == sizeof("rrlib.rtti.test.PrefixedClass.NestedClass") - 1, "Compile-time name has wrong length");
+    TestCompileTimeTypeName<Class2>(true);
+    TestCompileTimeTypeName<tPrefixedClass>(true);
+    TestCompileTimeTypeName<tPrefixedClass::tNestedClass>(true);
+    TestCompileTimeTypeName<tPrefixedClass::tEnum>(true);
+    TestCompileTimeTypeName<tType>(true);
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("rrlib.rtti.test.PrefixedClass.NestedClass"), std::string(rrlib::rtti::detail::tCompileTimeTypeName<tPrefixedClass::tNestedClass>::Get()));
+#endif
+    TestCompileTimeTypeName<int>(false);
+    TestCompileTimeTypeName<std::vector<Class2>>(false);
+    TestCompileTimeTypeName<TemplateClass<Class2>>(false);
+  }
+
+  void TestInternedNames()
+  {
+    tDataType<Class1> type;
+    RRLIB_UNIT_TESTS_ASSERT(type.GetInternedName() == tInternedName(type.GetName()));
+    RRLIB_UNIT_TESTS_ASSERT(type.GetInternedName() == tInternedName::Find("rrlib.rtti.test.Class1"));
+    RRLIB_UNIT_TESTS_ASSERT(&type.GetInternedName().GetString() == &type.GetName());
+    RRLIB_UNIT_TESTS_EQUALITY(std::hash<std::string>()(type.GetName()), type.GetInternedName().GetHash());
+    RRLIB_UNIT_TESTS_ASSERT(type.GetInternedName(true) == tInternedName("Class1"));
+    RRLIB_UNIT_TESTS_ASSERT(tInternedName::Find("rrlib.rtti.test.NotInterned") == tInternedName());
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("NULL"), tType().GetInternedName().GetString());
+  }
+
+  void TestRegistrationBatch()
+  {
+    tType type, type_list;
+    {
+      tType::tRegistrationBatch batch;
+      tType::tRegistrationBatch nested_batch;
+      type_list = tDataType<std::vector<BatchRenamedClass>>();
+      type = tDataType<BatchRenamedClass>();
+      RRLIB_UNIT_TESTS_EQUALITY(std::string("List<Batch Name>"), tType::GetTypeNameFromRtti(typeid(std::vector<BatchRenamedClass>).name()));
+      tType found_by_other_thread;
+      std::thread other_thread([&found_by_other_thread]()
+      {
+        found_by_other_thread = tType::FindType("Batch Name"); // batch must not block other threads
+      });
+      other_thread.join();
+      RRLIB_UNIT_TESTS_ASSERT(found_by_other_thread == type);
+    }
+    RRLIB_UNIT_TESTS_ASSERT(tType::FindType("Batch Name") == type);
+    RRLIB_UNIT_TESTS_ASSERT(tType::FindType(type_list.GetName()) == type_list);
+    RRLIB_UNIT_TESTS_ASSERT(tType::FindType("List<Batch Name>") == type_list);
+  }
+
+  void TestUnregisterBinary()
+  {
+    uint16_t type_count = tType::GetTypeCount();
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(0), tType::UnregisterBinary("librrlib_rtti_not_loaded.so"));
+    RRLIB_UNIT_TESTS_EQUALITY(type_count, tType::GetTypeCount());
+    {
+      tType::tUnregistrationGuard guard;
+      tType::tUnregistrationGuard nested_guard;
+      RRLIB_UNIT_TESTS_ASSERT(tType::GetType(tDataType<Class1>().GetUid()) == tDataType<Class1>());
+    }
+    RRLIB_UNIT_TESTS_ASSERT(tType::FindType("Class1") == tDataType<Class1>());
+  }
+
+  void TestUnregisterLoadedBinary()
+  {
+    void* handle = dlopen("librrlib_rtti_test_plugin.so", RTLD_NOW | RTLD_LOCAL);
+    RRLIB_UNIT_TESTS_ASSERT_MESSAGE(std::string("Could not load test plugin: ") + dlerror(), handle != NULL);
+    if (!handle)
+    {
+      return;
+    }
+    tType plugin_type = tType::FindType("PluginClass"), plugin_list_type = tType::FindType("List<PluginClass>");
+    RRLIB_UNIT_TESTS_ASSERT(plugin_type != NULL && plugin_list_type != NULL && plugin_type.GetListType() == plugin_list_type);
+    int16_t lowest_uid = std::min(plugin_type.GetUid(), plugin_list_type.GetUid());
+    static tTypeSideTable<int> side_table;
+    side_table.Set(plugin_type, 42);
+    tGenericObjectPool& plugin_pool = tGenericObjectPool::GetInstance(plugin_type);
+    plugin_pool.Release(plugin_pool.Acquire()); // block remains in this thread's cache
+    plugin_pool.Reserve(4);
+    tDataType<std::vector<UnregistrationRenamedClass>> renamed_list_type; // element type is renamed after unregistration
+
+    // Thread holding a guard looks up types while unregistration waits for it
+    std::atomic<bool> guard_acquired(false), guard_released(false);
+    std::thread guard_thread([&]()
+    {
+      tType::tUnregistrationGuard guard;
+      guard_acquired = true;
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+      tType::FindType("Class1");
+      tGenericObjectPool& list_pool = tGenericObjectPool::GetInstance(plugin_list_type); // pool is created during unregistration
+      list_pool.Release(list_pool.Acquire());
+      guard_released = true;
+    });
+    while (!guard_acquired)
+    {
+      std::this_thread::yield();
+    }
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(2), tType::UnregisterBinary(plugin_type.GetBinary(true)));
+    RRLIB_UNIT_TESTS_ASSERT(guard_released);
+    guard_thread.join();
+    dlclose(handle);
+
+    RRLIB_UNIT_TESTS_ASSERT(tType::FindType("PluginClass") == NULL && tType::FindType("List<PluginClass>") == NULL);
+    RRLIB_UNIT_TESTS_ASSERT(tType::GetType(lowest_uid) == NULL);
+    tType new_type = tDataType<UnregistrationTestClass>();
+    RRLIB_UNIT_TESTS_EQUALITY(lowest_uid, new_type.GetUid());
+    RRLIB_UNIT_TESTS_EQUALITY(0, side_table[new_type]);
+    tGenericObjectPool& new_pool = tGenericObjectPool::GetInstance(new_type);
+    RRLIB_UNIT_TESTS_ASSERT(&new_pool != &plugin_pool && new_pool.GetType() == new_type);
+    RRLIB_UNIT_TESTS_ASSERT(new_type.GetListType() != NULL && tGenericObjectPool::GetInstance(new_type.GetListType()).GetType() == new_type.GetListType());
+    new_pool.Release(new_pool.Acquire()); // cached blocks of released pool are deallocated if uid is the same
+
+    // Names of remaining template types are still updated when types are renamed
+    tDataType<UnregistrationRenamedClass> renamed_type;
+    RRLIB_UNIT_TESTS_ASSERT(tType::FindType("List<Unregistration Name>") == renamed_list_type);
+    RRLIB_UNIT_TESTS_EQUALITY(tType::GetFingerprint("List<Unregistration Name>"), renamed_list_type.GetFingerprint());
+  }
+
+  void TestTypeTables()
+  {
+    tDataType<std::vector<Class2>> list_type;
+    tType element_type = list_type.GetElementType();
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(tType::GetTypeCount()), tType::GetNameTable().size());
+    RRLIB_UNIT_TESTS_ASSERT(tType::GetNameTable()[list_type.GetUid()] == list_type.GetInternedName());
+    RRLIB_UNIT_TESTS_EQUALITY(list_type.GetSize(), tType::GetSizeTable()[list_type.GetUid()]);
+    RRLIB_UNIT_TESTS_EQUALITY(list_type.GetSize(true), tType::GetSizeTable(true)[list_type.GetUid()]);
+    RRLIB_UNIT_TESTS_EQUALITY(list_type.GetTypeTraits(), tType::GetTypeTraitsTable()[list_type.GetUid()]);
+    RRLIB_UNIT_TESTS_ASSERT(tType::GetClassificationTable()[list_type.GetUid()] == tType::tClassification::LIST);
+    RRLIB_UNIT_TESTS_EQUALITY(element_type.GetUid(), tType::GetElementTypeUidTable()[list_type.GetUid()].load());
+    RRLIB_UNIT_TESTS_EQUALITY(list_type.GetUid(), tType::GetListTypeUidTable()[element_type.GetUid()].load());
+  }
+
+  template <int N>
+  void AddTestAnnotations(tType type, std::integral_constant<int, N>)
+  {
+    tTestAnnotation<N>* annotation = new tTestAnnotation<N>();
+    type.AddAnnotation(annotation);
+    RRLIB_UNIT_TESTS_ASSERT(type.GetAnnotation<tTestAnnotation<N>>() == annotation);
+    AddTestAnnotations(type, std::integral_constant < int, N - 1 > ());
+  }
+
+  void AddTestAnnotations(tType type, std::integral_constant<int, 0>)
+  {}
+
+  void TestAnnotations()
+  {
+    tType type = tDataType<AnnotatedClass>();
+    RRLIB_UNIT_TESTS_ASSERT(type.GetAnnotation<tTestAnnotation<1>>() == NULL);
+    AddTestAnnotations(type, std::integral_constant<int, 20>());
+    RRLIB_UNIT_TESTS_ASSERT(type.GetAnnotation<tTestAnnotation<1>>() != NULL && type.GetAnnotation<tTestAnnotation<1>>()->GetAnnotatedType() == type);
+    RRLIB_UNIT_TESTS_ASSERT(type.GetAnnotation<tTestAnnotation<20>>() != NULL);
+    RRLIB_UNIT_TESTS_ASSERT(tType(tDataType<Class2>()).GetAnnotation<tTestAnnotation<20>>() == NULL);
+  }
+
+  void TestSideTable()
+  {
+    tTypeSideTable<const char*> table;
+    tType type = tDataType<Class1>(), other_type = tDataType<Class2>();
+    RRLIB_UNIT_TESTS_ASSERT(table.Get(type) == NULL && table[tType()] == NULL);
+    table.Set(type, "value");
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("value"), std::string(table[type]));
+    RRLIB_UNIT_TESTS_ASSERT(table.Get(other_type) == NULL);
+  }
+
+  void TestGenericObjectPool()
+  {
+    tDataType<std::vector<int>> type;
+    tGenericObjectPool& pool = tGenericObjectPool::GetInstance(type);
+    RRLIB_UNIT_TESTS_ASSERT(&pool == &tGenericObjectPool::GetInstance(type) && pool.GetType() == type);
+    pool.Reserve(4);
+    tGenericObject* object = pool.Acquire();
+    RRLIB_UNIT_TESTS_ASSERT(object->GetType() == type && object->GetData<std::vector<int>>().empty());
+    object->GetData<std::vector<int>>().push_back(42);
+    const void* address = object;
+    pool.Release(object);
+    object = pool.Acquire();
+    RRLIB_UNIT_TESTS_ASSERT(object == address && object->GetData<std::vector<int>>().empty());
+    pool.Release(object);
+  }
+
+  void TestGenericObjectArena()
+  {
+    tGenericObjectArena arena(256);
+    tType char_type = tDataType<char>(), double_type = tDataType<double>(), string_type = tDataType<std::string>();
+    RRLIB_UNIT_TESTS_EQUALITY(alignof(double), double_type.GetAlignment());
+    tGenericObject* first = char_type.CreateInstanceGeneric(arena);
+    for (size_t i = 0; i < 20; i++)
+    {
+      tGenericObject* object = (i % 2 ? double_type : string_type).CreateInstanceGeneric(arena);
+      RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(0), reinterpret_cast<uintptr_t>(object) % object->GetType().GetAlignment(true));
+      RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(0), reinterpret_cast<uintptr_t>(object->GetRawDataPointer()) % object->GetType().GetAlignment());
+      if (object->GetType() == string_type)
+      {
+        object->GetData<std::string>() = "A string that is long enough to be allocated on the heap";
+      }
+    }
+    RRLIB_UNIT_TESTS_ASSERT(arena.GetAllocatedSize() >= 10 * (double_type.GetSize(true) + string_type.GetSize(true)));
+    arena.Reset();
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(0), arena.GetAllocatedSize());
+    RRLIB_UNIT_TESTS_ASSERT(char_type.CreateInstanceGeneric(arena) == first);
+  }
+
+  void TestEmplacedGenericObject()
+  {
+    tType type = tDataType<DestructorCountingClass>();
+    typename std::aligned_storage<sizeof(DestructorCountingClass), alignof(DestructorCountingClass)>::type data;
+    typename std::aligned_storage<64, alignof(tGenericObject)>::type wrapper;
+    RRLIB_UNIT_TESTS_ASSERT(type.GetEmplacedGenericObjectSize() <= sizeof(wrapper));
+    int destructor_calls = DestructorCountingClass::destructor_calls;
+    tGenericObject* object = type.EmplaceInstanceGeneric(&data, &wrapper);
+    RRLIB_UNIT_TESTS_ASSERT(object == reinterpret_cast<tGenericObject*>(&wrapper) && object->GetRawDataPointer() == &data);
+    RRLIB_UNIT_TESTS_EQUALITY(destructor_calls, DestructorCountingClass::destructor_calls);
+    tType::DestroyInstanceGeneric(object);
+    RRLIB_UNIT_TESTS_EQUALITY(destructor_calls + 1, DestructorCountingClass::destructor_calls);
+  }
+
+  void TestGenericArray()
+  {
+    tType type = tDataType<std::string>();
+    tGenericArray array = type.CreateArrayGeneric(100);
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(100), array.Size());
+    RRLIB_UNIT_TESTS_EQUALITY(sizeof(std::string), array.GetStride());
+    for (size_t i = 0; i < array.Size(); i++)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(array.GetData<std::string>(i).empty());
+      RRLIB_UNIT_TESTS_ASSERT(array.GetElementPointer(i) == &array.GetData<std::string>(i));
+      array.GetData<std::string>(i) = "A string that is long enough to be allocated on the heap";
+    }
+    bool overflow_detected = false;
+    try
+    {
+      type.CreateArrayGeneric(SIZE_MAX / 2);
+    }
+    catch (const std::bad_alloc&)
+    {
+      overflow_detected = true;
+    }
+    RRLIB_UNIT_TESTS_ASSERT(overflow_detected);
+    tGenericArray moved(std::move(array));
+    RRLIB_UNIT_TESTS_ASSERT(array.Empty() && moved.Size() == 100 && moved.GetData<std::string>(99).length() > 0);
+    moved.Clear();
+    RRLIB_UNIT_TESTS_ASSERT(moved.Empty() && moved.GetRawDataPointer() == NULL);
+  }
+
+  void TestGenericValue()
+  {
+    tType double_type = tDataType<double>(), large_type = tDataType<LargeClass>();
+    tGenericValue small(double_type), large(large_type);
+    RRLIB_UNIT_TESTS_ASSERT(small.IsStoredInline() && (!large.IsStoredInline()));
+    small.GetData<double>() = 4.2;
+    large.GetData<LargeClass>().values[7] = 4.2;
+    tGenericValue small_copy(small), large_copy(large);
+    RRLIB_UNIT_TESTS_ASSERT(small_copy == small && large_copy == large && small != large);
+    large_copy.GetData<LargeClass>().values[7] = 0;
+    RRLIB_UNIT_TESTS_ASSERT(large_copy != large);
+    const void* large_data = large.GetRawDataPointer();
+    large_copy = std::move(large);
+    RRLIB_UNIT_TESTS_EQUALITY(4.2, large_copy.GetData<LargeClass>().values[7]);
+    RRLIB_UNIT_TESTS_ASSERT(large_copy.GetRawDataPointer() == large_data); // heap block is taken over
+    RRLIB_UNIT_TESTS_ASSERT(large.GetType() == NULL && large.GetRawDataPointer() == NULL);
+    tGenericValue small_moved(std::move(small_copy));
+    RRLIB_UNIT_TESTS_ASSERT(small_moved == small && small_copy.GetType() == NULL && small_copy.GetRawDataPointer() == NULL);
+
+    static_assert(std::is_nothrow_move_constructible<tGenericValue>::value && std::is_nothrow_move_assignable<tGenericValue>::value, "Moving tGenericValue must not throw");
+    static_assert(!std::is_move_constructible<NonMovableClass>::value, "NonMovableClass must not be movable");
+    tGenericValue non_movable((tDataType<NonMovableClass>()));
+    RRLIB_UNIT_TESTS_ASSERT(!non_movable.IsStoredInline()); // moving might throw (default-constructs and deep-copies value)
+    non_movable.GetData<NonMovableClass>().value = 42;
+    tGenericValue non_movable_moved(std::move(non_movable));
+    RRLIB_UNIT_TESTS_EQUALITY(42, non_movable_moved.GetData<NonMovableClass>().value);
+    RRLIB_UNIT_TESTS_ASSERT(non_movable.GetType() == NULL);
+
+    tType string_type = tDataType<std::string>(), int_type = tDataType<int>();
+    tGenericValue string_value(string_type);
+    string_value.GetData<std::string>() = "A string that is long enough to be allocated on the heap";
+    serialization::tMemoryBuffer buffer;
+    serialization::tOutputStream output_stream(buffer);
+    output_stream << string_value << small;
+    output_stream.Close();
+    serialization::tInputStream input_stream(buffer);
+    tGenericValue deserialized_string, deserialized_small(int_type);
+    input_stream >> deserialized_string >> deserialized_small;
+    RRLIB_UNIT_TESTS_ASSERT(deserialized_string == string_value && deserialized_small == small);
+  }
+
+  void TestOperationTable()
+  {
+    tType type = tDataType<std::string>();
+    const tType::tOperations& operations = type.GetOperations();
+    std::string source = "A string that is long enough to be allocated on the heap", copy;
+    operations.deep_copy(&source, &copy, NULL);
+    RRLIB_UNIT_TESTS_ASSERT(operations.equals(&source, &copy));
+
+    typename std::aligned_storage<sizeof(std::string), alignof(std::string)>::type moved;
+    operations.move_construct(&copy, &moved);
+    RRLIB_UNIT_TESTS_ASSERT(operations.equals(&source, &moved)); // state of moved-from copy is unspecified
+    operations.destruct(&moved, 1);
+
+    std::unique_ptr<tGenericObject> object(type.CreateInstanceGeneric());
+    object->GetData<std::string>() = source;
+    std::unique_ptr<tGenericObject> object_copy(type.CreateInstanceGeneric());
+    object_copy->DeepCopyFrom(*object);
+    RRLIB_UNIT_TESTS_ASSERT(object->Equals(*object_copy));
+  }
+
+#if RRLIB_RTTI_REGISTRATION_PROFILING_ENABLED
+  void TestRegistrationProfiles()
+  {
+    std::string test_binary = cSTATICALLY_REGISTERED_TYPE.GetBinary(true); // empty for executables (binary detection only recognizes shared libraries)
+    size_t type_count = 0;
+    bool contains_static_type = false;
+    for (const tRegistrationProfile & profile : GetRegistrationProfiles())
+    {
+      if (profile.binary == test_binary)
+      {
+        type_count++;
+        contains_static_type |= profile.uid == cSTATICALLY_REGISTERED_TYPE.GetUid();
+      }
+    }
+    RRLIB_UNIT_TESTS_ASSERT(type_count > 0 && contains_static_type);
+  }
+#endif
+
+  void TestTypeSets()
+  {
+    tType int_type = tDataType<int>(), uint_type = tDataType<unsigned int>(), double_type = tDataType<double>(), enum_type = tDataType<tPrefixedClass::tEnum>();
+    tTypeSet signed_integers = tType::GetTypesWithAllTraits(trait_flags::cIS_INTEGRAL | trait_flags::cIS_SIGNED);
+    RRLIB_UNIT_TESTS_ASSERT(signed_integers.Contains(int_type) && (!signed_integers.Contains(uint_type)) && (!signed_integers.Contains(double_type)));
+    tTypeSet floats_and_enums = tType::GetTypesWithAnyTrait(trait_flags::cIS_FLOATING_POINT | trait_flags::cIS_ENUM);
+    RRLIB_UNIT_TESTS_ASSERT(floats_and_enums.Contains(double_type) && floats_and_enums.Contains(enum_type) && (!floats_and_enums.Contains(int_type)));
+    RRLIB_UNIT_TESTS_ASSERT((signed_integers & floats_and_enums).Empty());
+    RRLIB_UNIT_TESTS_EQUALITY(signed_integers.Count() + floats_and_enums.Count(), (signed_integers | floats_and_enums).Count());
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(tType::GetTypeCount()), tType::GetTypesWithAllTraits(0).Count());
+    std::vector<tType> enums = tType::GetTypesWithAllTraits(trait_flags::cIS_ENUM).ToVector();
+    RRLIB_UNIT_TESTS_ASSERT(enums.size() >= 1 && enums.size() == floats_and_enums.Count() - tType::GetTypesWithAllTraits(trait_flags::cIS_FLOATING_POINT).Count());
+  }
+
 };
 
 RRLIB_UNIT_TESTS_REGISTER_SUITE(tTestTraitsRtti);
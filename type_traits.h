@@ -46,6 +46,7 @@
 #include "rrlib/rtti/tIsListType.h"
 #include "rrlib/rtti/detail/generic_operations.h"
 #include "rrlib/rtti/detail/type_traits.h"
+#include "rrlib/rtti/detail/type_names.h"
 
 //----------------------------------------------------------------------
 // Namespace declaration
@@ -89,6 +90,7 @@ static const int cIS_POINTER = 1 << 17;
 static const int cIS_SCALAR = 1 << 18;
 static const int cIS_SIGNED = 1 << 19;
 static const int cIS_UNSIGNED = 1 << 20;
+static const int cIS_NOTHROW_MOVE_CONSTRUCTIBLE = 1 << 21;
 
 } // namespace
 
@@ -120,7 +122,8 @@ struct tTypeTraitsVector
     (std::is_pointer<T>::value ? trait_flags::cIS_POINTER : 0) |
     (std::is_scalar<T>::value ? trait_flags::cIS_SCALAR : 0) |
     (std::is_signed<T>::value ? trait_flags::cIS_SIGNED : 0) |
-    (std::is_unsigned<T>::value ? trait_flags::cIS_UNSIGNED : 0)
+    (std::is_unsigned<T>::value ? trait_flags::cIS_UNSIGNED : 0) |
+    (std::is_nothrow_move_constructible<T>::value ? trait_flags::cIS_NOTHROW_MOVE_CONSTRUCTIBLE : 0)
 #ifdef _LIB_RRLIB_SERIALIZATION_PRESENT_
     | (serialization::IsBinarySerializable<T>::value ? trait_flags::cIS_BINARY_SERIALIZABLE : 0) |
     (serialization::IsStringSerializable<T>::value ? trait_flags::cIS_STRING_SERIALIZABLE : 0) |
@@ -174,6 +177,19 @@ struct SupportsBitwiseCopy
   enum { value = std::is_trivially_destructible<T>::value && (!std::has_virtual_destructor<T>::value) && (!std::is_polymorphic<T>::value) };
 };
 
+/*!
+ * Type trait that defines whether memory is set to zero before an object of type T
+ * is constructed by tType::CreateInstanceGeneric (and similar functions).
+ * This is required if equality is tested using memcmp - so that padding bytes and uninitialized
+ * members do not make equal objects differ. For other (e.g. large buffer) types, zero-filling is skipped.
+ * May be specialized - e.g. for types relying on zero-filled memory.
+ */
+template <typename T>
+struct RequiresZeroFill
+{
+  enum { value = SupportsBitwiseCopy<T>::value && (!HasEqualToOperator<T>::value) };
+};
+
 /*!
  * Type trait to get 'normalized' type for type T.
  * It is used to reduce the number of int types to a platform-independent subset.
@@ -219,6 +235,11 @@ struct TypeName
    */
   static std::string Get()
   {
+    typedef detail::tCompileTimeTypeName<T> tCompileTimeName;
+    if (tCompileTimeName::cAVAILABLE)
+    {
+      return detail::AddCompileTimeTypeName(typeid(T).name(), tCompileTimeName::GetDemangled(), tCompileTimeName::End() - tCompileTimeName::Begin(), tCompileTimeName::Get());
+    }
     return tType::GetTypeNameFromRtti(typeid(T).name());
   }
 };